@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <list>
 #include <memory>
@@ -46,10 +47,12 @@
 #include "CADPolynomials.h"
 #include "CADTypes.h"
 #include "CADSettings.h"
+#include "Cell.h"
 #include "ConflictGraph.h"
 #include "Constraint.h"
 #include "EliminationSet.h"
 #include "SampleSet.h"
+#include "SignCache.h"
 #include "Variables.h"
 
 namespace carl {
@@ -95,6 +98,11 @@ private:
 	 */
 	bool iscomplete;
 	
+	/**
+	 * flag indicating that polynomials were removed and the sample tree may contain cells that can be merged
+	 */
+	bool mergePending;
+	
 	/**
 	 * flag indicating whether the check procedure terminated with true because of an interrupt
 	 */
@@ -112,6 +120,11 @@ private:
 	
 	cad::CADConstraints<Number> mConstraints;
 	
+	/**
+	 * signs of the constraint polynomials at the sample tree nodes
+	 */
+	cad::SignCache<Number> mSignCache;
+	
 	static unsigned checkCallCount;
 
 public:
@@ -179,6 +192,10 @@ public:
 	const Tree& getSampleTree() const {
 		return sampleTree;
 	}
+	
+	const cad::SignCache<Number>& getSignCache() const {
+		return mSignCache;
+	}
 
 	/**
 	* @return list of main variables of the polynomials of this cad
@@ -335,6 +352,25 @@ public:
 		return this->check(_constraints, r, cg, bounds, next, checkBounds);
 	}
 
+	/**
+	 * Model-based check of the given constraints on a single sample point.
+	 *
+	 * Instead of decomposing the whole space, only the cylindrical cell around the given sample is computed in which all constraints violated by the sample stay violated.
+	 * The cell is computed by projecting the polynomials of the violated constraints, where paired projections are only done with the polynomials bounding the cell at the respective level (single cell projection).
+	 * Thus, a caller can exclude the whole cell from the search and choose the next sample outside of it, for example from a model of some other theory solver.
+	 *
+	 * The variables of the constraints must be known to the cad, i.e. either added by addPolynomial() or given in the constructor.
+	 * @param constraints conjunction of input constraints
+	 * @param r sample point, its components correspond to getVariables()
+	 * @param cell contains the cell around r if false is returned, one bound for each variable in the order of getVariables()
+	 * @param conflictGraph r is added as a new sample point that violates all constraints violated by r
+	 * @return true if r satisfies all constraints, false otherwise
+	 */
+	cad::Answer checkCell(	const std::vector<cad::Constraint<Number>>& constraints,
+				const RealAlgebraicPoint<Number>& r,
+				cad::Cell<Number>& cell,
+				cad::ConflictGraph<Number>& conflictGraph );
+
 	/**
 	 * Insert the given polynomial into the cad.
 	 * Creates a copy from the given polynomial.
@@ -360,6 +396,15 @@ public:
 	 * @param childrenOnly only remove the children of pPtr (recursively)
 	 */
 	void removePolynomial(const UPolynomial* p, unsigned level = 0, bool childrenOnly = false);
+
+	/**
+	 * Merges adjacent cells of the sample tree that were only separated by polynomials which have been removed meanwhile.
+	 * A root sample is removed if none of the polynomials of its elimination level vanishes at its sample point.
+	 * The sectors around such a root are merged by keeping the better of the two samples (according to the sample ordering) together with its subtree.
+	 * All other subtrees are left untouched.
+	 * This is done lazily, i.e. only once before the next check after removePolynomial() was called.
+	 */
+	void mergeCells();
 	
 	/**
 	 * Get the boundaries of the cad cell intervals in each level for the solution point r.
@@ -461,9 +506,9 @@ private:
 	 *
 	 * @param node
 	 * @param root of the sample tree
-	 * @return RealAlgebraicPoint as list belonging to leaf
+	 * @return Components of the RealAlgebraicPoint belonging to leaf
 	 */
-	std::list<RealAlgebraicNumber<Number>> constructSampleAt(sampleIterator node, const sampleIterator& root) const;
+	std::vector<RealAlgebraicNumber<Number>> constructSampleAt(sampleIterator node, const sampleIterator& root) const;
 
 	/**
 	 * Helper method for mainCheck() routine.
@@ -531,6 +576,16 @@ public:
      */
 	sampleIterator storeSampleInTree(RealAlgebraicNumber<Number> newSample, sampleIterator node);
 	
+	/**
+	 * Checks if the full-dimensional sample at the given leaf satisfies the current constraints.
+	 * If setting.cacheConstraintSigns is set, the sign of each constraint polynomial is taken from or stored in mSignCache at the ancestor of node where all variables of the constraint are assigned.
+	 * @param node Leaf of the sample tree.
+	 * @param sample Sample at node.
+	 * @param conflictGraph Stores the result as a new sample if setting.computeConflictGraph is set.
+	 * @return If all constraints are satisfied.
+	 */
+	bool satisfiedBy(const sampleIterator& node, const RealAlgebraicPoint<Number>& sample, cad::ConflictGraph<Number>& conflictGraph);
+	
 	cad::Answer baseLiftCheck(
 		sampleIterator node,
 		RealAlgebraicPoint<Number>& r,
@@ -542,6 +597,27 @@ public:
 		cad::ConflictGraph<Number>& conflictGraph
 	);
 
+	/**
+	 * Propagates the constraints over the box given by the sample at node and the bounds of the open variables, similar to the revise step of HC4.
+	 * Every constraint is evaluated over the box by interval arithmetic.
+	 * If some constraint can not be satisfied within the box, the whole subtree of node is infeasible.
+	 * Otherwise, the interval of every open variable occurring linearly in a constraint is contracted by solving the constraint for this variable.
+	 * As contraction prunes samples that would otherwise be stored in the conflict graph, it is only performed if setting.computeConflictGraph is not set.
+	 * @param node Node of the sample tree, assigning all variables below mVariables[level].
+	 * @param level Index of the variable to be lifted next.
+	 * @param bounds Bounds for the variables represented by their index.
+	 * @param interval Receives the admissible interval for mVariables[level].
+	 * @param conflictGraph Stores the infeasible constraint as a new sample if setting.computeConflictGraph is set.
+	 * @return False if the constraints are infeasible within the box, true otherwise.
+	 */
+	bool propagateBounds(
+		const sampleIterator& node,
+		std::size_t level,
+		const BoundMap& bounds,
+		Interval<Number>& interval,
+		cad::ConflictGraph<Number>& conflictGraph
+	);
+
 	/**
 	 * Constructs sample points for the given number of open variables openVariableCount by lifting
 	 * the polynomials available in the lifting queue in the corresponding level of CAD::eliminationSets.
@@ -581,7 +657,48 @@ public:
 			cad::ConflictGraph<Number>& conflictGraph,
 			std::stack<std::size_t>& satPath
 	);
-	
+
+	/**
+	 * Performs liftCheck for all given nodes of the sample tree, which must all reside at the same depth, using the given number of threads.
+	 *
+	 * Every node is lifted within a private copy of the lifting state, consisting of the lifting queues of the levels below openVariableCount, the path from the root to the node and the subtree below the node.
+	 * The nodes are handed out to the threads one at a time, hence threads that finish early continue with the remaining nodes.
+	 * As soon as some node yields a satisfying sample (or an unknown answer), all other threads are interrupted and this answer is returned.
+	 * Afterwards, the subtrees and conflict graphs of all lifted nodes are merged back in the order of the nodes.
+	 * Only used if liftingThreadCount() is larger than one, i.e. if carl is built with THREAD_SAFE.
+	 * @param nodes Nodes to lift.
+	 * @param openVariableCount number of variables still to be substituted by lifting
+	 * @param threads number of threads, must be larger than one
+	 * @param variables list of variables. Note that the first variable is always the last one lifted.
+	 * @param bounds bounds for the variables represented by their index.
+	 * @param boundsActive true if bounds are defined, false otherwise
+	 * @param checkBounds if true, all points are checked against the bounds
+	 * @param r RealAlgebraicPoint which contains the satisfying sample point if the check results true
+	 * @param conflictGraph This is a conflict graph. See CAD::check for a full description.
+	 * @return The first answer that is not False, or False if all nodes were lifted without success.
+	 */
+	cad::Answer parallelLiftCheck(
+			const std::vector<sampleIterator>& nodes,
+			std::size_t openVariableCount,
+			std::size_t threads,
+			const std::list<Variable>& variables,
+			const BoundMap& bounds,
+			bool boundsActive,
+			bool checkBounds,
+			RealAlgebraicPoint<Number>& r,
+			cad::ConflictGraph<Number>& conflictGraph
+	);
+
+	/**
+	 * Appends copies of all descendants of from in source as descendants of to in destination.
+	 * @param source Tree to copy from.
+	 * @param from Root of the subtree to copy, which is not copied itself.
+	 * @param destination Tree to copy to.
+	 * @param to Node receiving the copies as children.
+	 * @param detach If set, the samples are copied by RealAlgebraicNumber::deepCopy().
+	 */
+	static void copySubtree(const Tree& source, const sampleIterator& from, Tree& destination, const sampleIterator& to, bool detach);
+
 	/**
 	 * If eliminationSets[level].emptyLiftingQueue() is true,
 	 * perform elimination steps so that eliminationSets[level] or eliminationSets[l] for any l smaller than level
@@ -641,6 +758,21 @@ public:
 		return false;
 	}
 
+	/**
+	 * Determines the number of threads used for lifting, which is setting.liftingThreads if carl is built with THREAD_SAFE and one otherwise.
+	 * @return Number of lifting threads.
+	 */
+	std::size_t liftingThreadCount() const {
+#ifdef THREAD_SAFE
+		return std::max<std::size_t>(this->setting.liftingThreads, 1);
+#else
+		if (this->setting.liftingThreads > 1) {
+			CARL_LOG_WARN("carl.cad", "Parallel lifting requires THREAD_SAFE, using a single thread.");
+		}
+		return 1;
+#endif
+	}
+
 	template<typename It>
 	bool isSampleConsistent(It node) const {
 		bool lastRoot = false;
@@ -17,6 +17,7 @@
 #include "../formula/model/ran/RealAlgebraicNumberSettings.h"
 #include "../core/rootfinder/RootFinder.h"
 #include "../thom/ThomRootFinder.h"
+#include "../util/ThreadPool.h"
 
 #define PERFORM_PARTIAL_CHECK false
 
@@ -32,6 +33,7 @@ CAD<Number>::CAD():
 		eliminationSets(),
 		polynomials(),
 		iscomplete(false),
+		mergePending(false),
 		interrupted(false),
 		interrupts(),
 		setting(cad::CADSettings::getSettings())
@@ -47,6 +49,7 @@ CAD<Number>::CAD(cad::PolynomialOwner<Number>* parent):
 		eliminationSets(),
 		polynomials(parent),
 		iscomplete(false),
+		mergePending(false),
 		interrupted(false),
 		interrupts(),
 		setting(cad::CADSettings::getSettings())
@@ -93,8 +96,10 @@ CAD<Number>::CAD(const CAD<Number>& cad):
 		eliminationSets( cad.eliminationSets ),
 		polynomials( cad.polynomials ),
 		iscomplete( cad.iscomplete ),
+		mergePending( cad.mergePending ),
 		interrupted( cad.interrupted ),
-		setting( cad.setting )
+		setting( cad.setting ),
+		mSignCache( cad.mSignCache )
 {
 }
 
@@ -207,6 +212,8 @@ bool CAD<Number>::prepareElimination() {
 	}
 
 	std::size_t newVariableCount = mVariables.newSize();
+	// new polynomials split existing cells, which are refined by the lifting queues of the new polynomials
+	this->iscomplete = false;
 
 	/* Algorithm overview:
 	 *
@@ -333,6 +340,9 @@ void CAD<Number>::completeElimination(const CAD<Number>::BoundMap& bounds) {
 					this->eliminationSets[l-1].erase(p);
 				}
 			}
+			if (this->setting.projectionThreads > 1) {
+				this->eliminationSets[l-1].eliminateAllInto(this->eliminationSets[l], mVariables[l], this->setting);
+			}
 			while (!this->eliminationSets[l-1].emptyPairedEliminationQueue()) {
 				this->eliminationSets[l-1].eliminateNextInto(this->eliminationSets[l], mVariables[l], this->setting);
 			}
@@ -340,6 +350,9 @@ void CAD<Number>::completeElimination(const CAD<Number>::BoundMap& bounds) {
 	} else {
 		// unbounded elimination from level l-1 to level l
 		for (unsigned l = 1; l < this->eliminationSets.size(); l++) {
+			if (this->setting.projectionThreads > 1) {
+				this->eliminationSets[l-1].eliminateAllInto(this->eliminationSets[l], mVariables[l], this->setting);
+			}
 			while (	!this->eliminationSets[l-1].emptySingleEliminationQueue() ||
 					!this->eliminationSets[l-1].emptyPairedEliminationQueue()) {
 				this->eliminationSets[l-1].eliminateNextInto(this->eliminationSets[l], mVariables[l], this->setting, false);
@@ -358,8 +371,10 @@ void CAD<Number>::clear() {
 	this->polynomials.clear();
 	this->polynomials.clearScheduled();
 	this->iscomplete = false;
+	this->mergePending = false;
 	this->interrupted = false;
 	this->interrupts.clear();
+	this->mSignCache.invalidate();
 	this->checkCallCount = 0;
 }
 
@@ -408,6 +423,7 @@ cad::Answer CAD<Number>::check(
 {
 	assert(this->sampleTree.isConsistent());
 	this->prepareElimination();
+	this->mergeCells();
 	assert(this->sampleTree.isConsistent());
 	mConstraints.set(_constraints, mVariables);
     #ifdef LOGGING_CARL
@@ -598,6 +614,101 @@ cad::Answer CAD<Number>::check(
 	return satisfiable;
 }
 
+template<typename Number>
+cad::Answer CAD<Number>::checkCell(
+	const std::vector<cad::Constraint<Number>>& constraints,
+	const RealAlgebraicPoint<Number>& r,
+	cad::Cell<Number>& cell,
+	cad::ConflictGraph<Number>& conflictGraph)
+{
+	this->prepareElimination();
+	assert(r.dim() == mVariables.size());
+	cell.clear();
+
+	// collect the violated constraints
+	std::vector<const cad::Constraint<Number>*> violated;
+	for (const auto& c: constraints) {
+		if (!c.satisfiedBy(r, mVariables.getCurrent())) violated.push_back(&c);
+	}
+	if (violated.empty()) {
+		CARL_LOG_DEBUG("carl.cad", "Sample " << r << " satisfies all constraints.");
+		return cad::Answer::True;
+	}
+	std::size_t sampleID = conflictGraph.newSample();
+	for (const auto& c: violated) {
+		conflictGraph.set(conflictGraph.getConstraint(*c), sampleID, true);
+	}
+	if (mVariables.empty()) return cad::Answer::False;
+
+	// the projection polynomials of this cell are released when returning, the cell keeps copies of its bounds
+	cad::PolynomialOwner<Number> owner;
+	cad::EliminationSet<Number> current(&owner, typename cad::EliminationSet<Number>::PolynomialComparator(this->setting.order), typename cad::EliminationSet<Number>::PolynomialComparator(this->setting.order));
+	for (const auto& c: violated) {
+		auto up = c->getPolynomial().toUnivariatePolynomial(mVariables.front());
+		if (up.isNumber()) continue;
+		current.insert(owner.take(new UPolynomial(up.pseudoPrimpart())));
+	}
+	current.makeSquarefree();
+
+	const std::size_t dim = mVariables.size();
+	for (std::size_t level = 0; level < dim; level++) {
+		// sample of the lower dimensional variables
+		std::map<Variable, RealAlgebraicNumber<Number>> m;
+		for (std::size_t l = level + 1; l < dim; l++) m.emplace(mVariables[l], r[l]);
+		const RealAlgebraicNumber<Number>& value = r[level];
+
+		cad::CellBound<Number> bound(mVariables[level]);
+		// polynomials bounding the cell from below and above and vanishing at the sample, if any
+		const UPolynomial* lower = nullptr;
+		const UPolynomial* upper = nullptr;
+		const UPolynomial* section = nullptr;
+		for (const auto& p: current.getPolynomials()) {
+			if (p->isConstant()) continue;
+			auto roots = carl::rootfinder::realRoots(*p, m, Interval<Number>::unboundedInterval(), this->setting.splittingStrategy);
+			if (!roots) {
+				// p vanishes identically over the sample, its coefficients are projected anyway
+				CARL_LOG_DEBUG("carl.cad", *p << " vanishes over " << m);
+				continue;
+			}
+			for (const auto& root: *roots) {
+				if (root == value) {
+					if (section == nullptr) section = p;
+				} else if (root < value) {
+					if (lower == nullptr || bound.lowerRoot < root) {
+						lower = p;
+						bound.lowerRoot = root;
+					}
+				} else if (upper == nullptr || root < bound.upperRoot) {
+					upper = p;
+					bound.upperRoot = root;
+				}
+			}
+		}
+		if (section != nullptr) {
+			bound.section = true;
+			lower = section;
+			upper = section;
+			bound.lowerRoot = value;
+			bound.upperRoot = value;
+		}
+		if (lower != nullptr) bound.lower = std::make_shared<const UPolynomial>(*lower);
+		if (upper == lower) bound.upper = bound.lower;
+		else if (upper != nullptr) bound.upper = std::make_shared<const UPolynomial>(*upper);
+		CARL_LOG_DEBUG("carl.cad", "Cell bound on level " << level << ": " << bound);
+
+		if (level + 1 < dim) {
+			std::vector<const UPolynomial*> bounds;
+			if (lower != nullptr) bounds.push_back(lower);
+			if (upper != nullptr && upper != lower) bounds.push_back(upper);
+			cad::EliminationSet<Number> next(&owner, typename cad::EliminationSet<Number>::PolynomialComparator(this->setting.order), typename cad::EliminationSet<Number>::PolynomialComparator(this->setting.order));
+			current.eliminateCellInto(bounds, next, mVariables[level+1], this->setting);
+			std::swap(current, next);
+		}
+		cell.push_back(bound);
+	}
+	return cad::Answer::False;
+}
+
 template<typename Number>
 void CAD<Number>::addPolynomial(const MPolynomial& p, const std::vector<Variable>& v) {
 	CARL_LOG_TRACE("carl.cad", __func__ << "( " << p << ", " << v << " )");
@@ -640,6 +751,7 @@ void CAD<Number>::removePolynomial(const MPolynomial& polynomial) {
 		auto p = this->eliminationSets[level].find(up);
 		if (p != nullptr) {
 			this->removePolynomial(p, level);
+			this->mergePending = true;
 			return;
 		}
 	}
@@ -685,7 +797,7 @@ void CAD<Number>::removePolynomial(const UPolynomial* p, unsigned level, bool ch
 	 *
 	 */
 	std::size_t maxDepth = this->sampleTree.max_depth();
-	auto sampleTreeRoot = this->sampleTree.begin();
+	std::size_t initialMaxDepth = maxDepth;
 	for (int l = (int)dim - 1; l >= (int)level; l--) {
 		assert(this->sampleTree.isConsistent());
 		// iterate from the leaves to the root (more efficient if several levels are to be cleaned)
@@ -699,9 +811,93 @@ void CAD<Number>::removePolynomial(const UPolynomial* p, unsigned level, bool ch
 					node = this->sampleTree.erase(node);
 				}
 				maxDepth = depth-1;
+				// the erased samples have to be lifted again
+				this->iscomplete = false;
 			}
 		}
 	}
+	if (maxDepth < initialMaxDepth) {
+		// release the memory of the erased levels
+		this->sampleTree.compact();
+		this->mSignCache.invalidate();
+	}
+	assert(this->sampleTree.isConsistent());
+}
+
+template<typename Number>
+void CAD<Number>::mergeCells() {
+	if (!this->mergePending) return;
+	this->mergePending = false;
+	CARL_LOG_FUNC("carl.cad", "");
+	assert(this->sampleTree.isConsistent());
+
+	const std::size_t dim = mVariables.size();
+	if (dim == 0) return;
+	typename cad::SampleSet<Number>::SampleComparator comp(setting.sampleOrdering);
+	auto sampleTreeRoot = this->sampleTree.begin();
+	std::size_t maxDepth = this->sampleTree.max_depth(sampleTreeRoot);
+	std::size_t removed = 0;
+	// proceed from the base level to the top, such that no subtree is visited that is removed afterwards
+	for (std::size_t depth = 0; depth < maxDepth && depth < dim; depth++) {
+		// elimination level of the children of the nodes at depth
+		std::size_t level = dim - depth - 1;
+		std::vector<Variable> variables(mVariables.begin() + (long)level, mVariables.end());
+		std::vector<sampleIterator> parents;
+		for (auto node = this->sampleTree.begin_depth(depth); node != this->sampleTree.end_depth(); node++) {
+			parents.push_back(node);
+		}
+		for (const auto& parent: parents) {
+			// children that are kept, in ascending order
+			std::vector<sampleIterator> kept;
+			std::vector<sampleIterator> children;
+			for (auto child = this->sampleTree.begin_children(parent); child != this->sampleTree.end_children(parent); child++) {
+				children.push_back(child);
+			}
+			for (std::size_t i = 0; i < children.size(); i++) {
+				const auto& child = children[i];
+				if (!child->isRoot() || kept.empty() || kept.back()->isRoot() || i + 1 == children.size() || children[i+1]->isRoot()) {
+					kept.push_back(child);
+					continue;
+				}
+				// the root separates two sectors, check if it is still a root of some polynomial
+				std::vector<RealAlgebraicNumber<Number>> sampleList = this->constructSampleAt(child, sampleTreeRoot);
+				if (sampleList.size() != depth + 1) {
+					kept.push_back(child);
+					continue;
+				}
+				RealAlgebraicPoint<Number> sample(sampleList);
+				bool vanishes = false;
+				for (const auto& p: this->eliminationSets[level].getPolynomials()) {
+					if (RealAlgebraicNumberEvaluation::evaluate(MPolynomial(*p), sample, variables).isZero()) {
+						vanishes = true;
+						break;
+					}
+				}
+				if (vanishes) {
+					kept.push_back(child);
+					continue;
+				}
+				// merge the two sectors around child into the better one
+				const auto& right = children[i+1];
+				CARL_LOG_DEBUG("carl.cad", "Merging cells around " << *child);
+				if (comp(*kept.back(), *right)) {
+					this->sampleTree.erase(kept.back());
+					kept.back() = right;
+				} else {
+					this->sampleTree.erase(right);
+				}
+				this->sampleTree.erase(child);
+				removed += 2;
+				i++;
+			}
+		}
+	}
+	CARL_LOG_DEBUG("carl.cad", "Removed " << removed << " samples by merging cells");
+	if (removed > 0) {
+		// release the memory of the merged cells
+		this->sampleTree.compact();
+		this->mSignCache.invalidate();
+	}
 	assert(this->sampleTree.isConsistent());
 }
 
@@ -930,7 +1126,7 @@ void CAD<Number>::alterSetting(const cad::CADSettings& _setting) {
 }
 
 template<typename Number>
-std::list<RealAlgebraicNumber<Number>> CAD<Number>::constructSampleAt(sampleIterator node, const sampleIterator& root) const {
+std::vector<RealAlgebraicNumber<Number>> CAD<Number>::constructSampleAt(sampleIterator node, const sampleIterator& root) const {
 	/* Main sample construction loop macro augmented by a conditional argument for termination with an empty sample.
 	 * @param _condition which has to be false for every node of the sample, otherwise an empty list is returned
 	 */
@@ -940,7 +1136,8 @@ std::list<RealAlgebraicNumber<Number>> CAD<Number>::constructSampleAt(sampleIter
 		return {};
 	}
 
-	std::list<RealAlgebraicNumber<Number>> v;
+	std::vector<RealAlgebraicNumber<Number>> v;
+	v.reserve(mVariables.size());
 	// proceed from the leaf up to the root while the children of root represent the last component of the sample point and the leaf the first
 	if (this->setting.equationsOnly) {
 		while (node != root) {
@@ -1011,10 +1208,7 @@ typename CAD<Number>::CheckNodeResult CAD<Number>::checkNode(
 		// found a sample to check with the constraints
 		if (excludePrevious) return CNR_SKIP;
 
-		if (
-			(this->setting.computeConflictGraph && mConstraints.satisfiedBy(sample, getVariables(), conflictGraph)) ||
-			(!this->setting.computeConflictGraph && mConstraints.satisfiedBy(sample, getVariables()))
-			) {
+		if (this->satisfiedBy(node, sample, conflictGraph)) {
 			r = sample;
 			CARL_LOG_TRACE("carl.cad", "sample is good!");
 			return CNR_TRUE;
@@ -1196,6 +1390,8 @@ cad::Answer CAD<Number>::mainCheck(
 	assert(maxDepth == (unsigned)dim || maxDepth == (unsigned)0 || boundsNontrivial);
 	CARL_LOG_TRACE("carl.cad", __func__ << ": Phase 3");
 
+	// nodes are only collected for parallelLiftCheck if more than one thread is available
+	std::size_t liftingThreads = liftingThreadCount();
 	while (true) {
 		//bool didProgress = false;
 		// search base level with open lifting position
@@ -1226,10 +1422,13 @@ cad::Answer CAD<Number>::mainCheck(
 		CARL_LOG_TRACE("carl.cad", "Current depth = " << depth << ", level = " << level);
 		CARL_LOG_TRACE("carl.cad", this->sampleTree);
 		assert(depth >= 0 && depth < dim);
-		assert(depth <= (unsigned)this->sampleTree.max_depth());
+		// bounds may prune all nodes at this depth
+		assert(depth <= (unsigned)this->sampleTree.max_depth() || boundsNontrivial);
+		// nodes collected for parallel lifting if liftingThreads > 1
+		std::vector<sampleIterator> liftingNodes;
 		for (auto node = this->sampleTree.begin_depth(depth); node != this->sampleTree.end_depth(); node++) {
 			// traverse all nodes at depth, i.e., sample points of dimension dim - level - 1 equaling the number of coefficient variables of the lifting position at level
-			std::list<RealAlgebraicNumber<Number>> sampleList = this->constructSampleAt(node, sampleTreeRoot);
+			std::vector<RealAlgebraicNumber<Number>> sampleList = this->constructSampleAt(node, sampleTreeRoot);
 			// no degenerate sample points are considered here because they were already discarded in Phase 2
 			if (depth != sampleList.size()) continue;
 
@@ -1264,6 +1463,10 @@ cad::Answer CAD<Number>::mainCheck(
 				vars.push_front(mVariables[i]);
 			}
 			assert(level + 1 == (int)i);
+			if (liftingThreads > 1) {
+				liftingNodes.push_back(node);
+				continue;
+			}
 			// perform lifting at the incomplete leaf with the stored queue (reset performed in liftCheck)
 			std::stack<std::size_t> satPath;
 			CARL_LOG_DEBUG("carl.cad", "lifting on " << *node);
@@ -1277,6 +1480,16 @@ cad::Answer CAD<Number>::mainCheck(
 				return cad::Answer::Unknown;
 			}
 		}
+		if (!liftingNodes.empty()) {
+			std::list<Variable> vars;
+			for (std::size_t l = (std::size_t)(level + 1); l < dim; l++) vars.push_back(mVariables[l]);
+			cad::Answer status = parallelLiftCheck(liftingNodes, (std::size_t)(level + 1), liftingThreads, vars, bounds, boundsNontrivial, checkBounds, r, conflictGraph);
+			if (status != cad::Answer::False) return status;
+		}
+		// nodes pruned by bounds or by propagation did not consume the lifting positions
+		while (!this->eliminationSets[(unsigned)level].emptyLiftingQueue()) {
+			this->eliminationSets[(unsigned)level].popLiftingPosition();
+		}
 		this->eliminationSets[(unsigned)level].setLiftingPositionsReset();
 		//if (!didProgress) break;
 	}
@@ -1313,6 +1526,37 @@ typename CAD<Number>::sampleIterator CAD<Number>::storeSampleInTree(RealAlgebrai
 	return newNode;
 }
 
+template<typename Number>
+bool CAD<Number>::satisfiedBy(const sampleIterator& node, const RealAlgebraicPoint<Number>& sample, cad::ConflictGraph<Number>& conflictGraph) {
+	const std::size_t dim = mVariables.size();
+	assert(sample.dim() == dim);
+	cad::ConflictGraph<Number>* cg = (this->setting.computeConflictGraph ? &conflictGraph : nullptr);
+	if (!this->setting.cacheConstraintSigns) {
+		if (cg == nullptr) return mConstraints.satisfiedBy(sample, getVariables());
+		return mConstraints.satisfiedBy(sample, getVariables(), *cg);
+	}
+	// ancestors[d] is the ancestor of node at depth d, assigning the d lowest variables
+	std::vector<std::size_t> ancestors(dim + 1);
+	for (auto it = this->sampleTree.begin_path(node); it != this->sampleTree.end_path(); it++) {
+		assert(it.depth() <= dim);
+		ancestors[it.depth()] = it.id();
+	}
+	return mConstraints.satisfiedBy([&](std::size_t cid, std::size_t d){
+		const auto& c = mConstraints[cid];
+		std::size_t pid = mSignCache.polynomial(c.getPolynomial());
+		Sign sign;
+		if (mSignCache.get(ancestors[d], pid, sign)) return sign;
+		// evaluate on the d lowest variables
+		std::vector<Variable> vars(mVariables.end() - (long)d, mVariables.end());
+		std::vector<RealAlgebraicNumber<Number>> components;
+		for (std::size_t i = dim - d; i < dim; i++) components.push_back(sample[i]);
+		sign = RealAlgebraicNumberEvaluation::evaluate(c.getPolynomial(), RealAlgebraicPoint<Number>(std::move(components)), vars).sgn();
+		CARL_LOG_DEBUG("carl.cad", c.getPolynomial() << " has sign " << sign << " on " << vars);
+		mSignCache.put(ancestors[d], pid, sign);
+		return sign;
+	}, cg);
+}
+
 template<typename Number>
 cad::Answer CAD<Number>::baseLiftCheck(
 		sampleIterator node,
@@ -1330,8 +1574,7 @@ cad::Answer CAD<Number>::baseLiftCheck(
 	std::vector<RealAlgebraicNumber<Number>> sample(sampleTree.begin_path(node), sampleTree.end_path());
 	sample.pop_back();
 	RealAlgebraicPoint<Number> t(std::move(sample));
-	if ((this->setting.computeConflictGraph && mConstraints.satisfiedBy(t, getVariables(), conflictGraph)) ||
-		(!this->setting.computeConflictGraph && mConstraints.satisfiedBy(t, getVariables()))) {
+	if (this->satisfiedBy(node, t, conflictGraph)) {
 		r = t;
 		CARL_LOG_TRACE("carl.cad", "Returning true as a satisfying sample was found");
 		return cad::Answer::True;
@@ -1359,6 +1602,90 @@ cad::Answer CAD<Number>::partialLiftCheck(
 	return cad::Answer::False;
 }
 
+template<typename Number>
+bool CAD<Number>::propagateBounds(
+		const sampleIterator& node,
+		std::size_t level,
+		const BoundMap& bounds,
+		Interval<Number>& interval,
+		cad::ConflictGraph<Number>& conflictGraph
+) {
+	std::map<Variable, Interval<Number>> box;
+	// the sample components on the path from node to the root, the root itself carries no sample
+	std::size_t index = level + 1;
+	for (auto it = this->sampleTree.begin_path(node); index < mVariables.size(); it++, index++) {
+		if (it->isNumeric()) box.emplace(mVariables[index], Interval<Number>(it->value()));
+		else if (it->isInterval()) box.emplace(mVariables[index], it->getInterval());
+		else box.emplace(mVariables[index], Interval<Number>::unboundedInterval());
+	}
+	for (std::size_t i = 0; i <= level; i++) {
+		auto b = bounds.find(i);
+		if (b != bounds.end()) box.emplace(mVariables[i], b->second);
+		else box.emplace(mVariables[i], Interval<Number>::unboundedInterval());
+	}
+	Interval<Number> zero(Number(0));
+
+	bool changed = true;
+	// every round may contract the intervals of the open variables, which may in turn contract other intervals in the next round
+	for (std::size_t round = 0; changed && round <= level; round++) {
+		changed = false;
+		for (const auto& c: mConstraints) {
+			const auto& p = c.getPolynomial();
+			std::set<Variable> vars = p.gatherVariables();
+			for (const auto& v: vars) {
+				// variables that are not part of the CAD are unbounded
+				box.emplace(v, Interval<Number>::unboundedInterval());
+			}
+			Interval<Number> value = IntervalEvaluation::evaluate(p, box);
+			bool negative = c.satisfiedBy(Sign::NEGATIVE);
+			bool positive = c.satisfiedBy(Sign::POSITIVE);
+			bool feasible = (negative && !value.isSemiPositive()) || (c.satisfiedBy(Sign::ZERO) && value.contains(Number(0))) || (positive && !value.isSemiNegative());
+			if (!feasible) {
+				CARL_LOG_DEBUG("carl.cad", c << " is infeasible within " << box);
+				if (this->setting.computeConflictGraph) {
+					std::size_t sampleID = conflictGraph.newSample();
+					conflictGraph.set(conflictGraph.getConstraint(c), sampleID, true);
+				}
+				return false;
+			}
+			if (this->setting.computeConflictGraph) continue;
+			if (negative && positive) continue;
+			// interval the value of p must lie in, strict bounds are relaxed to weak bounds
+			Interval<Number> target = zero;
+			if (negative) target = Interval<Number>(Number(0), BoundType::INFTY, Number(0), BoundType::WEAK);
+			if (positive) target = Interval<Number>(Number(0), BoundType::WEAK, Number(0), BoundType::INFTY);
+			for (const auto& v: vars) {
+				auto vit = std::find(mVariables.begin(), mVariables.end(), v);
+				if (vit == mVariables.end() || (std::size_t)(vit - mVariables.begin()) > level) continue;
+				if (p.degree(v) != 1) continue;
+				// p = a*v + b
+				Interval<Number> a = IntervalEvaluation::evaluate(p.coeff(v, 1), box);
+				if (a.contains(Number(0))) continue;
+				Interval<Number> b = IntervalEvaluation::evaluate(p.coeff(v, 0), box);
+				Interval<Number> q = (target - b).div(a);
+				// Interval::div guesses the bound types, hence only use the bound values
+				Interval<Number> contracted(
+					q.lower(), q.lowerBoundType() == BoundType::INFTY ? BoundType::INFTY : BoundType::WEAK,
+					q.upper(), q.upperBoundType() == BoundType::INFTY ? BoundType::INFTY : BoundType::WEAK
+				);
+				Interval<Number>& current = box[v];
+				contracted = contracted.intersect(current);
+				if (contracted.isEmpty()) {
+					CARL_LOG_DEBUG("carl.cad", "Contracted " << v << " to the empty interval by " << c);
+					return false;
+				}
+				if (contracted != current) {
+					CARL_LOG_TRACE("carl.cad", "Contracted " << v << " from " << current << " to " << contracted << " by " << c);
+					current = contracted;
+					changed = true;
+				}
+			}
+		}
+	}
+	interval = box[mVariables[level]];
+	return true;
+}
+
 template<typename Number>
 cad::Answer CAD<Number>::liftCheck(
 		sampleIterator node,
@@ -1434,6 +1761,19 @@ cad::Answer CAD<Number>::liftCheck(
 	// see if bounds are given for this level
 	auto bound = boundsActive ? bounds.find(openVariableCount) : bounds.end();
 	bool boundActive = bounds.end() != bound;
+	// interval for the current variable admitted by the constraints over the current sample and the bounds
+	// pruning leaves the sample tree incomplete, which is only accounted for if bounds are active
+	Interval<Number> admissible = Interval<Number>::unboundedInterval();
+	if (this->setting.propagateBounds && boundsActive && checkBounds) {
+		if (!this->propagateBounds(node, openVariableCount, bounds, admissible, conflictGraph)) {
+			CARL_LOG_DEBUG("carl.cad", "Constraints are infeasible below " << *node);
+			return cad::Answer::False;
+		}
+	}
+	bool admissibleActive = !admissible.isInfinite();
+	if (admissibleActive) {
+		CARL_LOG_DEBUG("carl.cad", "Admissible interval for " << mVariables[openVariableCount] << " is " << admissible);
+	}
 
 	// restore the lifting queue.
 	this->eliminationSets[openVariableCount].resetLiftingPositions(restartLifting);
@@ -1561,12 +1901,18 @@ cad::Answer CAD<Number>::liftCheck(
 				computeMoreSamples = true;
 				break;
 			}
-			CARL_LOG_DEBUG("carl.cad", "Getting next sample from heap: " << sampleSetIncrement.getHeap());
+			CARL_LOG_DEBUG("carl.cad", "Getting next sample from " << sampleSetIncrement);
 			RealAlgebraicNumber<Number> newSample = sampleSetIncrement.next();
 			CARL_LOG_DEBUG("carl.cad", "Got " << newSample);
 
 			// Sample storage
 			auto newNode = this->storeSampleInTree(newSample, node);
+			if (admissibleActive && !newSample.containedIn(admissible)) {
+				// the constraints are infeasible for all extensions of this sample
+				CARL_LOG_DEBUG("carl.cad", "Skipping " << newSample << " outside of " << admissible);
+				sampleSetIncrement.pop();
+				continue;
+			}
 
 			// Lifting
 			// start lifting with the fresh new sample at the next level for *all* lifting positions
@@ -1635,6 +1981,104 @@ cad::Answer CAD<Number>::liftCheck(
 	return cad::Answer::False;
 }
 
+template<typename Number>
+cad::Answer CAD<Number>::parallelLiftCheck(
+		const std::vector<sampleIterator>& nodes,
+		std::size_t openVariableCount,
+		std::size_t threads,
+		const std::list<Variable>& variables,
+		const BoundMap& bounds,
+		bool boundsActive,
+		bool checkBounds,
+		RealAlgebraicPoint<Number>& r,
+		cad::ConflictGraph<Number>& conflictGraph
+) {
+	CARL_LOG_DEBUG("carl.cad", "Lifting " << nodes.size() << " nodes with " << threads << " threads");
+	struct LiftingWorker {
+		CAD<Number> state;
+		sampleIterator node;
+		cad::ConflictGraph<Number> conflictGraph;
+		RealAlgebraicPoint<Number> r;
+		cad::Answer answer;
+		explicit LiftingWorker(const cad::CADSettings& setting): state(setting), node(state.sampleTree.begin()), conflictGraph(), r(), answer(cad::Answer::False) {}
+	};
+	// set by the first worker that finds an answer, interrupts all other workers
+	std::atomic_bool answerFound(false);
+	std::atomic<std::size_t> winner(nodes.size());
+	std::vector<std::unique_ptr<LiftingWorker>> workers(nodes.size());
+
+	assert(threads > 1);
+	ThreadPool pool(threads - 1);
+	pool.parallelFor(nodes.size(), [&](std::size_t i){
+		if (answerFound.load()) return;
+		// the main sample tree is not modified until all workers have finished
+		std::unique_ptr<LiftingWorker> w(new LiftingWorker(this->setting));
+		w->state.mVariables = mVariables;
+		// liftCheck only consumes the lifting queues of the levels below openVariableCount
+		w->state.eliminationSets.reserve(openVariableCount);
+		for (std::size_t l = 0; l < openVariableCount; l++) {
+			w->state.eliminationSets.push_back(this->eliminationSets[l].liftingState());
+		}
+		w->state.mConstraints = mConstraints;
+		w->state.interrupts = this->interrupts;
+		w->state.interrupts.push_back(&answerFound);
+		std::vector<RealAlgebraicNumber<Number>> path(this->sampleTree.begin_path(nodes[i]), this->sampleTree.end_path());
+		assert(!path.empty());
+		path.pop_back();
+		for (auto it = path.rbegin(); it != path.rend(); it++) {
+			w->node = w->state.sampleTree.append(w->node, it->deepCopy());
+		}
+		copySubtree(this->sampleTree, nodes[i], w->state.sampleTree, w->node, true);
+
+		std::stack<std::size_t> satPath;
+		w->answer = w->state.liftCheck(w->node, openVariableCount, false, variables, bounds, boundsActive, checkBounds, w->r, w->conflictGraph, satPath);
+		if (w->answer != cad::Answer::False && !w->state.interrupted) {
+			bool expected = false;
+			if (answerFound.compare_exchange_strong(expected, true)) {
+				winner = i;
+			}
+		}
+		workers[i] = std::move(w);
+	});
+
+	// the subtrees are replaced, hence node IDs are reused
+	this->mSignCache.invalidate();
+	std::size_t last = nodes.size();
+	for (std::size_t i = 0; i < nodes.size(); i++) {
+		if (!workers[i]) continue;
+		this->sampleTree.eraseChildren(nodes[i]);
+		copySubtree(workers[i]->state.sampleTree, workers[i]->node, this->sampleTree, nodes[i], false);
+		conflictGraph.merge(workers[i]->conflictGraph);
+		last = i;
+	}
+	if (last < nodes.size()) {
+		// take the lifting queues of the last node lifted like sequential lifting would
+		for (std::size_t l = 0; l < openVariableCount; l++) {
+			this->eliminationSets[l].assignLiftingQueues(workers[last]->state.eliminationSets[l]);
+		}
+	}
+	assert(this->sampleTree.isConsistent());
+	if (winner < nodes.size()) {
+		CARL_LOG_DEBUG("carl.cad", "Lifting of node " << winner.load() << " found an answer");
+		r = workers[winner]->r;
+		return workers[winner]->answer;
+	}
+	if (this->anAnswerFound()) {
+		// interrupted from the outside
+		this->interrupted = true;
+		return cad::Answer::True;
+	}
+	return cad::Answer::False;
+}
+
+template<typename Number>
+void CAD<Number>::copySubtree(const Tree& source, const sampleIterator& from, Tree& destination, const sampleIterator& to, bool detach) {
+	for (auto child = source.begin_children(from); child != source.end_children(from); child++) {
+		sampleIterator copy = destination.append(to, detach ? child->deepCopy() : *child);
+		copySubtree(source, child, destination, copy, detach);
+	}
+}
+
 template<typename Number>
 int CAD<Number>::eliminate(std::size_t level, const BoundMap& bounds, bool boundsActive) {
 	CARL_LOG_FUNC("carl.cad.elimination", level << ", " << bounds);
@@ -30,28 +30,19 @@ public:
 	void set(const std::vector<cad::Constraint<Number>>& constraints, const cad::Variables& variables) {
 		mConstraints = constraints;
 		assert(variables.newSize() == 0);
-		mVariableLookup.resize(variables.size());
-		std::vector<bool> cons(mConstraints.size(), true);
-		
-		auto cur = mVariableLookup.begin();
-		auto vit = variables.rbegin();
-		for (vit++; vit != variables.rend(); vit++) {
-			cur->clear();
-			for (std::size_t c = 0; c < mConstraints.size(); c++) {
-				if (!cons[c]) continue;
-				const auto& cvars = mConstraints[c].getVariables();
-				if (std::includes(variables.rbegin(), vit, cvars.begin(), cvars.end())) {
-					cons[c] = false;
-					cur->push_back(c);
-				}
-			}
-			cur++;
-		}
-		cur->clear();
+		mVariableLookup.assign(std::max<std::size_t>(variables.size(), 1), std::vector<std::size_t>());
 		for (std::size_t c = 0; c < mConstraints.size(); c++) {
-			if (cons[c]) {
-				cur->push_back(c);
+			// number of the lowest variables (minus one) the constraint depends on
+			std::size_t level = 0;
+			for (const auto& v: mConstraints[c].getVariables()) {
+				auto it = std::find(variables.begin(), variables.end(), v);
+				if (it == variables.end()) {
+					level = mVariableLookup.size() - 1;
+					break;
+				}
+				level = std::max(level, (std::size_t)(variables.end() - it) - 1);
 			}
+			mVariableLookup[level].push_back(c);
 		}
 	}
 	
@@ -68,7 +59,7 @@ public:
 		return mConstraints.end();
 	}
 	
-	bool satisfiedPartiallyBy(RealAlgebraicPoint<Number>& r, const std::vector<Variable>& variables) const {
+	bool satisfiedPartiallyBy(const RealAlgebraicPoint<Number>& r, const std::vector<Variable>& variables) const {
 		if (r.dim() == 0) return true;
 		std::vector<Variable> vars(variables.begin() + (long)(variables.size() - r.dim()), variables.end());
 		std::size_t dim = vars.size()-1;
@@ -79,7 +70,7 @@ public:
 		return true;
 	}
 	
-	bool satisfiedPartiallyBy(RealAlgebraicPoint<Number>& r, const std::vector<Variable>& variables, cad::ConflictGraph<Number>& conflictGraph) const {
+	bool satisfiedPartiallyBy(const RealAlgebraicPoint<Number>& r, const std::vector<Variable>& variables, cad::ConflictGraph<Number>& conflictGraph) const {
 		if (r.dim() == 0) return true;
 		bool satisfied = true;
 		std::vector<Variable> vars(variables.begin() + (long)(variables.size() - r.dim()), variables.end());
@@ -96,13 +87,44 @@ public:
 		return satisfied;
 	}
 	
-	bool satisfiedBy(RealAlgebraicPoint<Number>& r, const std::vector<Variable>& variables) const {
+	const cad::Constraint<Number>& operator[](std::size_t id) const {
+		return mConstraints[id];
+	}
+	
+	/**
+	 * Checks if all constraints are satisfied, where the signs of the constraint polynomials are obtained from the given function.
+	 * The function is called as sign(id, dim) for each constraint id, where the constraint depends only on the dim lowest variables.
+	 * The constraints are processed bottom-up, i.e. constraints depending on less variables first.
+	 * @param sign Function retrieving the sign of a constraint polynomial.
+	 * @param conflictGraph If not nullptr, all constraints are checked and the result is stored as a new sample.
+	 * @return If all constraints are satisfied.
+	 */
+	template<typename SignFunction>
+	bool satisfiedBy(SignFunction&& sign, cad::ConflictGraph<Number>* conflictGraph) const {
+		bool satisfied = true;
+		std::size_t sampleID = (conflictGraph == nullptr ? 0 : conflictGraph->newSample());
+		for (std::size_t dim = 0; dim < mVariableLookup.size(); dim++) {
+			for (const auto& cid: mVariableLookup[dim]) {
+				const auto& c = mConstraints[cid];
+				bool sat = c.satisfiedBy(sign(cid, dim + 1));
+				if (conflictGraph == nullptr) {
+					if (!sat) return false;
+				} else {
+					conflictGraph->set(conflictGraph->getConstraint(c), sampleID, !sat);
+				}
+				satisfied = satisfied && sat;
+			}
+		}
+		return satisfied;
+	}
+	
+	bool satisfiedBy(const RealAlgebraicPoint<Number>& r, const std::vector<Variable>& variables) const {
 		for (const auto& c: mConstraints) {
 			if (!c.satisfiedBy(r, variables)) return false;
 		}
 		return true;
 	}
-	bool satisfiedBy(RealAlgebraicPoint<Number>& r, const std::vector<Variable>& variables, cad::ConflictGraph<Number>& conflictGraph) const {
+	bool satisfiedBy(const RealAlgebraicPoint<Number>& r, const std::vector<Variable>& variables, cad::ConflictGraph<Number>& conflictGraph) const {
 		bool satisfied = true;
 		std::size_t sampleID = conflictGraph.newSample();
 		for (const auto& c: mConstraints) {
@@ -7,11 +7,16 @@
 #pragma once
 
 #include <algorithm>
+#include <cstddef>
+#include <sstream>
+#include <string>
 
 #include "../core/logging.h"
 #include "../core/carlLogging.h"
 #include "../core/rootfinder/RootFinder.h"
 
+#include "Projection.h"
+
 namespace carl {
 namespace cad {
 
@@ -134,6 +139,8 @@ public:
 	bool simplifyEliminationByBounds;
 	/// given bounds to the check method, the bounds are widened after determining unsatisfiability by check, or shrunk after determining satisfiability by check
 	bool improveBounds;
+	/// propagate the constraints over the current sample and the bounds by interval arithmetic at every lifting level, pruning samples and subtrees outside the admissible box
+	bool propagateBounds;
 	bool exploreInteger;
 	bool splitInteger;
 	bool ignoreRoots;
@@ -142,6 +149,18 @@ public:
 	PolynomialComparisonOrder order;
 	/// standard strategy to be used for real root isolation
 	rootfinder::SplittingStrategy splittingStrategy;
+	/// projection operator used to compute the elimination polynomials
+	ProjectionType projectionType;
+	/// omit projection polynomials of constant sign, e.g. definite leading coefficients, for all projection operators
+	bool minimizeProjection;
+	/// take projection results from the process-wide ProjectionCache and store new results there (disabled by default, as the cache outlives all CAD objects)
+	bool useProjectionCache;
+	/// cache the signs of constraint polynomials at the sample tree nodes, such that samples sharing a lower dimensional cell share the evaluation
+	bool cacheConstraintSigns;
+	/// number of threads used to compute the projections of one level (requires THREAD_SAFE), 1 means sequential elimination
+	std::size_t projectionThreads;
+	/// number of threads used to lift the sample tree nodes of one level (requires THREAD_SAFE), 1 means sequential lifting
+	std::size_t liftingThreads;
 
 	/**
 	 * Generate a CADSettings instance of the respective preset type.
@@ -176,6 +195,7 @@ public:
 			cadSettings.earlyLiftingPruningByBounds = true;
 			cadSettings.improveBounds               = true;
 			cadSettings.preSolveByBounds            = false;
+			cadSettings.propagateBounds             = true;
 			cadSettings.removeConstants             = true;
 			cadSettings.simplifyByFactorization     = true;
 			cadSettings.simplifyByRootcounting      = false;
@@ -188,6 +208,7 @@ public:
 			cadSettings.earlyLiftingPruningByBounds = false;
 			cadSettings.improveBounds               = false;
 			cadSettings.preSolveByBounds            = false;
+			cadSettings.propagateBounds             = false;
 			cadSettings.removeConstants             = true;
 			cadSettings.simplifyByFactorization     = true;
 			cadSettings.simplifyByRootcounting      = false;
@@ -242,6 +263,23 @@ public:
 			settingStrs.push_back( "Given bounds to the check method, these bounds are used to cancel out elimination polynomials." );
 		if (settings.improveBounds)
 			settingStrs.push_back( "Given bounds to the check method, the bounds are widened after determining unsatisfiability by check, or shrunk after determining satisfiability by check." );
+		if (settings.propagateBounds)
+			settingStrs.push_back( "Propagate the constraints by interval arithmetic at every lifting level to prune samples." );
+		if (settings.projectionType != ProjectionType::Brown) {
+			std::stringstream ss;
+			ss << "Use the projection operator by " << settings.projectionType << ".";
+			settingStrs.push_back( ss.str() );
+		}
+		if (settings.minimizeProjection)
+			settingStrs.push_back( "Omit projection polynomials of constant sign." );
+		if (settings.useProjectionCache)
+			settingStrs.push_back( "Share projection results with other CAD objects using the process-wide projection cache." );
+		if (!settings.cacheConstraintSigns)
+			settingStrs.push_back( "Evaluate all constraints at every sample." );
+		if (settings.projectionThreads > 1)
+			settingStrs.push_back( "Compute the projections of each level using " + std::to_string(settings.projectionThreads) + " threads." );
+		if (settings.liftingThreads > 1)
+			settingStrs.push_back( "Lift the sample tree nodes of each level using " + std::to_string(settings.liftingThreads) + " threads." );
 		std::string orderStr = "Polynomial order: ";
 
 		if (settings.order == PolynomialComparisonOrder::CauchyBound)
@@ -280,12 +318,19 @@ private:
 		earlyLiftingPruningByBounds( true ),
 		simplifyEliminationByBounds( true ),
 		improveBounds( true ),
+		propagateBounds( false ),
 		exploreInteger(false),
 		splitInteger(true),
 		ignoreRoots(false),
 		integerHandling(IntegerHandling::SPLIT_ASSIGNMENT),
 		order(PolynomialComparisonOrder::Default),
-		splittingStrategy(rootfinder::SplittingStrategy::DEFAULT)
+		splittingStrategy(rootfinder::SplittingStrategy::DEFAULT),
+		projectionType(ProjectionType::Brown),
+		minimizeProjection(false),
+		useProjectionCache(false),
+		cacheConstraintSigns(true),
+		projectionThreads(1),
+		liftingThreads(1)
 	{}
 
 public:
@@ -306,12 +351,19 @@ public:
 		earlyLiftingPruningByBounds( s.earlyLiftingPruningByBounds ),
 		simplifyEliminationByBounds( s.simplifyEliminationByBounds ),
 		improveBounds( s.improveBounds ),
+		propagateBounds( s.propagateBounds ),
 		exploreInteger(s.exploreInteger),
 		splitInteger(s.splitInteger),
 		ignoreRoots(s.ignoreRoots),
 		integerHandling(s.integerHandling),
 		order(PolynomialComparisonOrder::Default),
-		splittingStrategy(rootfinder::SplittingStrategy::DEFAULT)
+		splittingStrategy(rootfinder::SplittingStrategy::DEFAULT),
+		projectionType(s.projectionType),
+		minimizeProjection(s.minimizeProjection),
+		useProjectionCache(s.useProjectionCache),
+		cacheConstraintSigns(s.cacheConstraintSigns),
+		projectionThreads(s.projectionThreads),
+		liftingThreads(s.liftingThreads)
 	{}
 };
 
@@ -0,0 +1,79 @@
+/**
+ * @file Cell.h
+ * @ingroup cad
+ *
+ * Contains the description of a single cylindrical cell as computed by CAD::checkCell().
+ */
+
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "../core/Variable.h"
+#include "../formula/model/ran/RealAlgebraicNumber.h"
+
+#include "CADTypes.h"
+
+namespace carl {
+namespace cad {
+
+/**
+ * The extent of a cylindrical cell in a single variable over the sample of the lower dimensional variables.
+ *
+ * The cell is either a section, i.e. a root of some polynomial, or a sector between the closest roots below and above the sample.
+ * A sector may be unbounded in either direction which is indicated by a nullptr instead of the bounding polynomial.
+ * The bound shares ownership of its bounding polynomials, such that it stays valid independently of the CAD it stems from.
+ */
+template<typename Number>
+struct CellBound {
+	/// Variable this bound refers to.
+	Variable variable;
+	/// Polynomial defining the lower bound, nullptr if unbounded.
+	std::shared_ptr<const UPolynomial<Number>> lower;
+	/// Polynomial defining the upper bound, nullptr if unbounded.
+	std::shared_ptr<const UPolynomial<Number>> upper;
+	/// Root of lower at the lower dimensional sample, only valid if lower is set.
+	RealAlgebraicNumber<Number> lowerRoot;
+	/// Root of upper at the lower dimensional sample, only valid if upper is set.
+	RealAlgebraicNumber<Number> upperRoot;
+	/// Indicates that the cell is a section, then lower and upper coincide.
+	bool section;
+
+	explicit CellBound(Variable::Arg v):
+		variable(v), lower(nullptr), upper(nullptr), lowerRoot(Number(0)), upperRoot(Number(0)), section(false)
+	{}
+
+	/**
+	 * Checks if the given value lies within this bound.
+	 * @param value Value for variable.
+	 * @return If value is within the section or the sector.
+	 */
+	bool contains(const RealAlgebraicNumber<Number>& value) const {
+		if (section) return value == lowerRoot;
+		if (lower != nullptr && value <= lowerRoot) return false;
+		if (upper != nullptr && value >= upperRoot) return false;
+		return true;
+	}
+};
+
+/**
+ * A single cylindrical cell, given as one CellBound for each variable of the CAD (in the order of the CAD variables).
+ */
+template<typename Number>
+using Cell = std::vector<CellBound<Number>>;
+
+template<typename Number>
+std::ostream& operator<<(std::ostream& os, const CellBound<Number>& b) {
+	if (b.section) return os << b.variable << " = " << b.lowerRoot << " (" << *b.lower << ")";
+	if (b.lower == nullptr) os << "-oo";
+	else os << b.lowerRoot << " (" << *b.lower << ")";
+	os << " < " << b.variable << " < ";
+	if (b.upper == nullptr) os << "oo";
+	else os << b.upperRoot << " (" << *b.upper << ")";
+	return os;
+}
+
+}
+}
@@ -12,7 +12,8 @@
 #include <map>
 #include <vector>
 
-#include <boost/dynamic_bitset.hpp>
+#include "../util/Bitset.h"
+#include "../util/Covering.h"
 
 #include "Constraint.h"
 
@@ -39,7 +40,9 @@ enum ConflictType
  * corresponding sample point. This information is fixed, however, we can invert the reading behavior by using invert().
  *
  * There is no explicit storage of sample point information. Thus, the graph cannot be used for memoaization of satisfiability results.
- * 
+ *
+ * The edges of each constraint are stored as a Bitset over the sample points, such that covering operations work on whole blocks and the degree of a constraint is a popcount.
+ * The set of samples violating any constraint is maintained incrementally while samples are added.
  */
 
 template<typename Number>
@@ -48,9 +51,19 @@ private:
 	/// Maps constraints to IDs used in mData
 	std::map<Constraint<Number>, std::size_t> mConstraints;
 	/// Stores for each constraints, which sample points violate the constraint
-	std::vector<boost::dynamic_bitset<>> mData;
+	std::vector<carl::Bitset> mData;
+	/// Stores which sample points violate some constraint
+	carl::Bitset mCovered;
 	/// Stores the number of samples that have been registered
 	std::size_t mSampleCount = 0;
+
+	/**
+	 * Recomputes the set of samples violating some constraint.
+	 */
+	void updateCovered() {
+		mCovered = carl::Bitset();
+		for (const auto& d: mData) mCovered |= d;
+	}
 public:
 
 	/**
@@ -64,6 +77,7 @@ public:
 	ConflictGraph(const ConflictGraph& g):
 		mConstraints(g.mConstraints),
 		mData(g.mData),
+		mCovered(g.mCovered),
 		mSampleCount(g.mSampleCount)
 	{
 		CARL_LOG_FUNC("carl.cad.cg", "Copied " << *this);
@@ -95,15 +109,30 @@ public:
 	std::size_t newSample() {
 		return mSampleCount++;
 	}
+	/**
+	 * Adds all samples of another graph as new samples of this graph.
+	 * Constraints are identified by their value, hence the constraint IDs of both graphs may differ.
+	 * @param g Other graph.
+	 */
+	void merge(const ConflictGraph& g) {
+		for (const auto& c: g.mConstraints) {
+			if (c.second >= g.mData.size()) continue;
+			std::size_t id = getConstraint(c.first);
+			const auto& data = g.mData[c.second];
+			for (std::size_t i = data.find_first(); i != carl::Bitset::npos; i = data.find_next(i)) {
+				set(id, mSampleCount + i, true);
+			}
+		}
+		mSampleCount += g.mSampleCount;
+	}
 	void set(std::size_t constraint, std::size_t sample, bool value) {
 		if (constraint >= mData.size()) {
 			mData.resize(constraint+1);
 		}
-		if (sample >= mData[constraint].size()) {
-			mData[constraint].resize(sample+1);
-		}
 		CARL_LOG_TRACE("carl.cad.cg", "Set " << constraint << " / " << sample << " to " << value);
-		mData[constraint][sample] = value;
+		mData[constraint].set(sample, value);
+		if (value) mCovered.set(sample);
+		else updateCovered();
 	}
 	/**
 	 * Retrieves the constraint that covers the most samples.
@@ -126,34 +155,41 @@ public:
 	 */
 	void selectConstraint(std::size_t id) {
 		assert(mData.size() > id);
-		// Store all samples point IDs
-		std::vector<std::size_t> queue;
-		queue.reserve(mData[id].count());
-		for (std::size_t i = mData[id].find_first(); i != boost::dynamic_bitset<>::npos; i = mData[id].find_next(i)) {
-			assert(mData[id][i]);
-			queue.push_back(i);
-		}
+		carl::Bitset selected = mData[id];
 		// Remove this constraint
-		mData[id].clear();
+		mData[id] = carl::Bitset();
 		// Disable sample points for other constraints
 		for (auto& d: mData) {
-			for (std::size_t i: queue) {
-				if (i >= d.size()) continue;
-				d[i] = false;
-			}
+			d -= selected;
 		}
+		mCovered -= selected;
 	}
 	/**
 	 * Checks if there are samples still uncovered.
 	 */
 	bool hasRemainingSamples() const {
-		for (const auto& d: mData) {
-			if (!d.none()) return true;
+		return mCovered.any();
+	}
+	/**
+	 * Computes a set of constraints such that every sample violates at least one of them, i.e. an infeasible subset if the samples represent a complete decomposition.
+	 * The graph is not modified.
+	 * @param exactLimit If there are at most that many constraints, a set of minimal size is computed by an exhaustive search, otherwise the set is computed greedily.
+	 * @return Constraints covering all samples.
+	 */
+	std::vector<cad::Constraint<Number>> getCover(std::size_t exactLimit = 0) const {
+		Covering<std::size_t> covering(mSampleCount);
+		for (std::size_t id = 0; id < mData.size(); id++) {
+			if (mData[id].count() > 0) covering.add(id, mData[id]);
 		}
-		return false;
+		std::vector<std::size_t> ids;
+		if (mData.size() <= exactLimit) covering.buildMinimalConflictingCore(ids);
+		else covering.buildConflictingCore(ids);
+		std::vector<cad::Constraint<Number>> res;
+		res.reserve(ids.size());
+		for (std::size_t id: ids) res.push_back(getConstraint(id));
+		return res;
 	}
 
-	
 	/**
 	 * Remove the specified constraint vertex by removing the respective index.
 	 * All other constraint indices are decreased by one.
@@ -168,6 +204,7 @@ public:
 		mConstraints.erase(it);
 		assert(mData.size() > cid);
 		mData.erase(mData.begin() + (long)cid);
+		updateCovered();
 		
 		for (auto& it: mConstraints) {
 			if (it.second > cid) it.second--;
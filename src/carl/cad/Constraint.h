@@ -113,10 +113,19 @@ public:
 		
 		auto res = RealAlgebraicNumberEvaluation::evaluate(this->polynomial, r, _variables);
 		CARL_LOG_DEBUG("carl.cad.constraint", *this << " evaluates to " << res << " on " << r);
+		return satisfiedBy(res.sgn());
+	}
+
+	/**
+	 * Test if the given sign of the polynomial satisfies this constraint.
+	 * @param s sign of the polynomial
+	 * @return false if the constraint was not satisfied by the sign, true otherwise.
+	 */
+	bool satisfiedBy(Sign s) const {
 		if (this->negated) {
-			return res.sgn() != this->sign;
+			return s != this->sign;
 		} else {
-			return res.sgn() == this->sign;
+			return s == this->sign;
 		}
 	}
 
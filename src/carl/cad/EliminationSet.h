@@ -13,6 +13,7 @@
 #include <utility>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "../util/pointerOperations.h"
 #include "../core/UnivariatePolynomial.h"
@@ -21,6 +22,7 @@
 #include "CADTypes.h"
 #include "CADSettings.h"
 #include "Projection.h"
+#include "ProjectionCache.h"
 
 namespace carl {
 namespace cad {
@@ -139,11 +141,60 @@ private:
 	 */
 	PolynomialComparator liftingOrder;
 
-	ProjectionType projectionType = ProjectionType::Brown;
-	ProjectionOperator<const UPolynomial*> projection;
-	template<typename... Args>
-	void project(Args&&... args) const {
-		projection(projectionType, std::forward<Args>(args)...);
+	/**
+	 * Collects the results of a projection together with their parents, such that projections can be computed independently of any EliminationSet.
+	 */
+	struct ProjectionResults {
+		std::vector<std::pair<UPolynomial, std::list<const UPolynomial*>>> results;
+		void insert(const UPolynomial& r, const std::list<const UPolynomial*>& parents, bool) {
+			results.emplace_back(r, parents);
+		}
+	};
+
+	/**
+	 * Applies the projection operator selected by setting.projectionType to p.
+	 * If setting.useProjectionCache is set, the results are taken from or stored in the ProjectionCache.
+	 */
+	template<typename Inserter>
+	void project(const CADSettings& setting, const UPolynomial* p, Variable::Arg variable, Inserter& i) const {
+		if (!setting.useProjectionCache) {
+			ProjectionOperator<const UPolynomial*>(setting.minimizeProjection)(setting.projectionType, p, variable, i);
+			return;
+		}
+		typename ProjectionCache<Coefficient>::Key key(setting.projectionType, setting.minimizeProjection, variable, *p);
+		projectCached(key, {p}, i, [&](ProjectionResults& raw){
+			ProjectionOperator<const UPolynomial*>(setting.minimizeProjection)(setting.projectionType, p, variable, raw);
+		});
+	}
+	/**
+	 * Applies the projection operator selected by setting.projectionType to p and q.
+	 * If setting.useProjectionCache is set, the results are taken from or stored in the ProjectionCache.
+	 */
+	template<typename Inserter>
+	void project(const CADSettings& setting, const UPolynomial* p, const UPolynomial* q, Variable::Arg variable, Inserter& i) const {
+		if (!setting.useProjectionCache) {
+			ProjectionOperator<const UPolynomial*>(setting.minimizeProjection)(setting.projectionType, p, q, variable, i);
+			return;
+		}
+		typename ProjectionCache<Coefficient>::Key key(setting.projectionType, setting.minimizeProjection, variable, *p, *q);
+		projectCached(key, {p, q}, i, [&](ProjectionResults& raw){
+			ProjectionOperator<const UPolynomial*>(setting.minimizeProjection)(setting.projectionType, p, q, variable, raw);
+		});
+	}
+	template<typename Inserter, typename F>
+	void projectCached(const typename ProjectionCache<Coefficient>::Key& key, const std::list<const UPolynomial*>& parents, Inserter& i, F&& compute) const {
+		std::vector<UPolynomial> results;
+		auto& cache = ProjectionCache<Coefficient>::getInstance();
+		if (!cache.getProjection(key, results)) {
+			ProjectionResults raw;
+			compute(raw);
+			results.reserve(raw.results.size());
+			for (const auto& r: raw.results) results.push_back(r.first);
+			cache.putProjection(key, results);
+		}
+		for (const auto& r: results) {
+			i.insert(r, parents, false);
+		}
 	}
 
 	/**
@@ -440,6 +491,28 @@ public:
 	void setLiftingPositionsReset() {
 		this->mLiftingQueueReset = this->mLiftingQueue;
 	}
+
+	/**
+	 * Creates an elimination set holding only what is needed for lifting, i.e. the polynomials and the lifting queues.
+	 * The elimination queues and the parent relation are not copied, hence the result must not be used for elimination.
+	 * @return Elimination set with the lifting state of this set.
+	 */
+	EliminationSet liftingState() const {
+		EliminationSet result(this->polynomialOwner, this->liftingOrder, this->eliminationOrder);
+		result.polynomials = this->polynomials;
+		result.mLiftingQueue = this->mLiftingQueue;
+		result.mLiftingQueueReset = this->mLiftingQueueReset;
+		return result;
+	}
+
+	/**
+	 * Takes over the lifting queues of the given set, which holds the same polynomials as this set, e.g. one created by liftingState().
+	 * @param s Elimination set.
+	 */
+	void assignLiftingQueues(const EliminationSet& s) {
+		this->mLiftingQueue = s.mLiftingQueue;
+		this->mLiftingQueueReset = s.mLiftingQueueReset;
+	}
 	
 	/////////////////////////////////////
 	// ELIMINATION POSITION MANAGEMENT //
@@ -529,6 +602,45 @@ public:
 			bool synchronous = false
 			);
 
+	/**
+	 * Does all pending eliminations of this set at once and stores the resulting polynomials into the specified destination set.
+	 *
+	 * The single projections of all polynomials in the single-elimination queue and the paired projections of all polynomials in the paired-elimination queue
+	 * with all other polynomials are independent of each other and are computed concurrently using setting.projectionThreads threads.
+	 * The results are merged in a fixed order, hence the parents stored in the destination set do not depend on the scheduling.
+	 * Afterwards, both elimination queues are empty.
+	 *
+	 * The result is the same as calling eliminateNextInto (non-synchronous) until both queues are empty.
+	 * Concurrency requires carl to be built with THREAD_SAFE, otherwise all projections are computed by the calling thread.
+	 * @param destination
+	 * @param variable the main variable of the destination elimination set
+	 * @param setting special settings for simplifications etc.
+	 * @return list of polynomials added to destination
+	 */
+	std::list<const UPolynomial*> eliminateAllInto(
+			EliminationSet<Coefficient>& destination,
+			Variable::Arg variable,
+			const CADSettings& setting
+			);
+
+	/**
+	 * Does the elimination of this set for a single cell and stores the resulting polynomials into the specified destination set.
+	 *
+	 * In contrast to a full elimination, only the single eliminations of all polynomials and the paired eliminations of the polynomials bounding the cell with all other polynomials are done.
+	 * The queues of this set are not touched.
+	 * @param bounds polynomials of this set bounding the cell
+	 * @param destination
+	 * @param variable the main variable of the destination elimination set
+	 * @param setting special settings for simplifications etc.
+	 * @return list of polynomials added to destination
+	 */
+	std::list<const UPolynomial*> eliminateCellInto(
+			const std::vector<const UPolynomial*>& bounds,
+			EliminationSet<Coefficient>& destination,
+			Variable::Arg variable,
+			const CADSettings& setting
+			) const;
+
 
 	
 	////////////////
@@ -5,6 +5,10 @@
  */
 #include "EliminationSet.h"
 #include "CADLogging.h"
+#include "../util/ThreadPool.h"
+
+#include <algorithm>
+#include <mutex>
 
 namespace carl {
 namespace cad {
@@ -333,7 +337,7 @@ std::list<const typename EliminationSet<Coefficient>::UPolynomial*> EliminationS
 		for (auto pol_it1: this->polynomials) {
 			assert(p->mainVar() == pol_it1->mainVar());
 			//eliminationEq( p, pol_it1, variable, newEliminationPolynomials, false );
-			project(p, pol_it1, variable, newEliminationPolynomials);
+			project(setting, p, pol_it1, variable, newEliminationPolynomials);
 		}
 		// (2) elimination with polynomial itself @todo: proof that we do not need that
 		// eliminationEq( p, p, variable, newEliminationPolynomials, setting );
@@ -342,7 +346,7 @@ std::list<const typename EliminationSet<Coefficient>::UPolynomial*> EliminationS
 		for (auto pol_it1: this->polynomials) {
 			assert(p->mainVar() == pol_it1->mainVar());
 			//elimination( p, pol_it1, variable, newEliminationPolynomials, false );
-			project(p, pol_it1, variable, newEliminationPolynomials);
+			project(setting, p, pol_it1, variable, newEliminationPolynomials);
 		}
 		// (2) elimination with polynomial itself @todo: proof that we do not need that
 		// elimination( p, p, variable, newEliminationPolynomials, setting );
@@ -353,10 +357,10 @@ std::list<const typename EliminationSet<Coefficient>::UPolynomial*> EliminationS
 
 	if( setting.equationsOnly ) {
 		//eliminationEq( p, variable, newEliminationPolynomials, false );
-		project(p, variable, newEliminationPolynomials);
+		project(setting, p, variable, newEliminationPolynomials);
 	} else {
 		//elimination( p, variable, newEliminationPolynomials, false );
-		project(p, variable, newEliminationPolynomials);
+		project(setting, p, variable, newEliminationPolynomials);
 	}
 
 
@@ -371,6 +375,48 @@ std::list<const typename EliminationSet<Coefficient>::UPolynomial*> EliminationS
 	return destination.insert( newEliminationPolynomials );
 }
 
+template<typename Coefficient>
+std::list<const typename EliminationSet<Coefficient>::UPolynomial*> EliminationSet<Coefficient>::eliminateCellInto(
+		const std::vector<const UPolynomial*>& bounds,
+		EliminationSet<Coefficient>& destination,
+		Variable::Arg variable,
+		const CADSettings& setting
+		) const
+{
+	EliminationSet<Coefficient> newEliminationPolynomials(this->polynomialOwner, this->liftingOrder, this->eliminationOrder);
+	std::list<const UPolynomial*> constants;
+	for (const auto& p: this->polynomials) {
+		if (p->isNumber()) continue;
+		if (p->isConstant()) {
+			/* constants can just be moved from this level to the next */
+			constants.push_back(this->polynomialOwner->take(new UPolynomial(p->switchVariable(variable))));
+			destination.insert(constants.back(), this->getParentsOf(p));
+			continue;
+		}
+		// single elimination
+		project(setting, p, variable, newEliminationPolynomials);
+		// paired elimination with the polynomials bounding the cell
+		auto pos = std::find(bounds.begin(), bounds.end(), p);
+		for (auto b = bounds.begin(); b != bounds.end(); b++) {
+			// pairs of bounds are eliminated only once
+			if (pos != bounds.end() && b >= pos) break;
+			assert((*b)->mainVar() == p->mainVar());
+			project(setting, *b, p, variable, newEliminationPolynomials);
+		}
+	}
+
+	// optimizations
+	if( setting.simplifyByFactorization )
+		newEliminationPolynomials.factorize();
+	newEliminationPolynomials.makePrimitive();
+	newEliminationPolynomials.makeSquarefree();
+	if( setting.simplifyByRootcounting )
+		newEliminationPolynomials.removePolynomialsWithoutRealRoots();
+	std::list<const UPolynomial*> res = destination.insert( newEliminationPolynomials );
+	res.insert(res.begin(), constants.begin(), constants.end());
+	return res;
+}
+
 template<typename Coefficient>
 std::list<const typename EliminationSet<Coefficient>::UPolynomial*> EliminationSet<Coefficient>::eliminateConstant(
 		const UPolynomial* p,
@@ -435,13 +481,13 @@ std::list<const typename EliminationSet<Coefficient>::UPolynomial*> EliminationS
 		if( setting.equationsOnly ) {
 			// (1) elimination with existing polynomials
 			for (auto pol_it1: this->polynomials)
-				project( p, pol_it1, variable, newEliminationPolynomials);
+				project(setting, p, pol_it1, variable, newEliminationPolynomials);
 			// (2) elimination with polynomial itself @todo: proof that we do not need that
 			// eliminationEq( p, p, variable, newEliminationPolynomials, setting );
 		} else {
 			// (1) elimination with existing polynomials
 			for (auto pol_it1: this->polynomials)
-				project( p, pol_it1, variable, newEliminationPolynomials);
+				project(setting, p, pol_it1, variable, newEliminationPolynomials);
 			// (2) elimination with polynomial itself @todo: proof that we do not need that
 			// elimination( p, p, variable, newEliminationPolynomials, setting );
 		}
@@ -454,9 +500,9 @@ std::list<const typename EliminationSet<Coefficient>::UPolynomial*> EliminationS
 	{
 		p = mSingleEliminationQueue.front();
 		if (setting.equationsOnly) {
-			project( p, variable, newEliminationPolynomials );
+			project(setting, p, variable, newEliminationPolynomials );
 		} else {
-			project( p, variable, newEliminationPolynomials );
+			project(setting, p, variable, newEliminationPolynomials );
 		}
 		mSingleEliminationQueue.pop_front();
 	}
@@ -472,6 +518,115 @@ std::list<const typename EliminationSet<Coefficient>::UPolynomial*> EliminationS
 	return destination.insert( newEliminationPolynomials, avoidSingle );
 }
 
+template<typename Coefficient>
+std::list<const typename EliminationSet<Coefficient>::UPolynomial*> EliminationSet<Coefficient>::eliminateAllInto(
+		EliminationSet<Coefficient>& destination,
+		Variable::Arg variable,
+		const CADSettings& setting
+		)
+{
+	std::list<const UPolynomial*> added;
+	std::set<const UPolynomial*> pendingSingle(mSingleEliminationQueue.begin(), mSingleEliminationQueue.end());
+	std::set<const UPolynomial*> pendingPaired(mPairedEliminationQueue.begin(), mPairedEliminationQueue.end());
+	// constants are just moved to the next level
+	std::vector<const UPolynomial*> constants;
+	for (auto p: this->polynomials) {
+		if (p->isConstant()) constants.push_back(p);
+	}
+	std::sort(constants.begin(), constants.end(), [this](const UPolynomial* a, const UPolynomial* b){ return this->eliminationOrder(*a, *b); });
+	for (auto p: constants) {
+		if (pendingSingle.count(p) == 0 && pendingPaired.count(p) == 0) continue;
+		if (p->isNumber()) {
+			DOT_NODE("elimination", p, "shape=box");
+			this->erase(p);
+			continue;
+		}
+		const UPolynomial* pNewVar = this->polynomialOwner->take(new UPolynomial(p->switchVariable(variable)));
+		if (destination.insert(pNewVar, this->getParentsOf(p)).second) added.push_back(pNewVar);
+		DOT_EDGE("elimination", p, pNewVar, "label=\"constant\"");
+		if (setting.removeConstants) {
+			DOT_NODE("elimination", p, "shape=box");
+			this->erase(p);
+		}
+	}
+
+	// collect all projections in a fixed order
+	std::vector<const UPolynomial*> sorted;
+	for (auto p: this->polynomials) {
+		if (!p->isConstant()) sorted.push_back(p);
+	}
+	std::sort(sorted.begin(), sorted.end(), [this](const UPolynomial* a, const UPolynomial* b){ return this->eliminationOrder(*a, *b); });
+	std::vector<std::pair<const UPolynomial*, const UPolynomial*>> tasks;
+	for (std::size_t i = 0; i < sorted.size(); i++) {
+		if (pendingSingle.count(sorted[i]) > 0) tasks.emplace_back(sorted[i], nullptr);
+	}
+	for (std::size_t i = 0; i < sorted.size(); i++) {
+		bool pairedI = pendingPaired.count(sorted[i]) > 0;
+		for (std::size_t j = i + 1; j < sorted.size(); j++) {
+			if (pairedI) tasks.emplace_back(sorted[i], sorted[j]);
+			else if (pendingPaired.count(sorted[j]) > 0) tasks.emplace_back(sorted[j], sorted[i]);
+		}
+	}
+	mSingleEliminationQueue.clear();
+	mPairedEliminationQueue.clear();
+	CARL_LOG_DEBUG("carl.cad.elimination", "Computing " << tasks.size() << " projections with " << setting.projectionThreads << " threads");
+
+	// results of the simplifications of the projection polynomials, shared among all threads
+	std::mutex simplifiedMutex;
+	std::unordered_map<UPolynomial, UPolynomial> simplified;
+	auto simplify = [&simplifiedMutex, &simplified, &setting](const UPolynomial& r) {
+		if (setting.useProjectionCache) return ProjectionCache<Coefficient>::getInstance().simplify(r);
+		{
+			std::lock_guard<std::mutex> lock(simplifiedMutex);
+			auto it = simplified.find(r);
+			if (it != simplified.end()) return it->second;
+		}
+		// same as makePrimitive() followed by makeSquarefree()
+		UPolynomial res = r.pseudoPrimpart().squareFreePart();
+		std::lock_guard<std::mutex> lock(simplifiedMutex);
+		return simplified.emplace(r, res).first->second;
+	};
+
+	std::vector<ProjectionResults> results(tasks.size());
+#ifdef THREAD_SAFE
+	std::size_t threads = std::max<std::size_t>(setting.projectionThreads, 1);
+#else
+	if (setting.projectionThreads > 1) {
+		CARL_LOG_WARN("carl.cad.elimination", "Parallel projection requires THREAD_SAFE, using a single thread.");
+	}
+	std::size_t threads = 1;
+#endif
+	ThreadPool pool(threads - 1);
+	pool.parallelFor(tasks.size(), [&](std::size_t i){
+		ProjectionResults raw;
+		if (tasks[i].second == nullptr) project(setting, tasks[i].first, variable, raw);
+		else project(setting, tasks[i].first, tasks[i].second, variable, raw);
+		for (const auto& r: raw.results) {
+			if (r.first.isNumber()) continue;
+			results[i].results.emplace_back(simplify(r.first), r.second);
+		}
+	});
+
+	// merge sequentially in the order of the tasks
+	EliminationSet<Coefficient> newEliminationPolynomials(this->polynomialOwner, this->liftingOrder, this->eliminationOrder);
+	for (const auto& res: results) {
+		for (const auto& r: res.results) {
+			newEliminationPolynomials.insert(r.first, r.second);
+		}
+	}
+	// the results are primitive and square-free already, but factorization may split them further
+	if( setting.simplifyByFactorization ) {
+		newEliminationPolynomials.factorize();
+		newEliminationPolynomials.makePrimitive();
+		newEliminationPolynomials.makeSquarefree();
+	}
+	if( setting.simplifyByRootcounting )
+		newEliminationPolynomials.removePolynomialsWithoutRealRoots();
+	std::list<const UPolynomial*> inserted = destination.insert( newEliminationPolynomials );
+	added.insert(added.end(), inserted.begin(), inserted.end());
+	return added;
+}
+
 template<typename Coefficient>
 void EliminationSet<Coefficient>::moveConstants(EliminationSet<Coefficient>& to, Variable::Arg variable ) {
 	std::forward_list<const UPolynomial*> toDelete;
@@ -3,20 +3,48 @@
 #include "../core/logging.h"
 #include "../core/Variable.h"
 
+#include <list>
+#include <type_traits>
+#include <vector>
+
 namespace carl {
 namespace cad {
 
     enum class ProjectionType: unsigned {
-        Brown, McCallum, Hong
+        Brown, McCallum, Hong, Lazard
     };
 
+	inline std::ostream& operator<<(std::ostream& os, ProjectionType pt) {
+		switch (pt) {
+			case ProjectionType::Brown: return os << "Brown";
+			case ProjectionType::McCallum: return os << "McCallum";
+			case ProjectionType::Hong: return os << "Hong";
+			case ProjectionType::Lazard: return os << "Lazard";
+		}
+		return os << "Unknown projection";
+	}
+
     template<typename Poly>
     struct ProjectionOperator {
+	private:
+		using UPoly = typename std::remove_cv<typename std::remove_pointer<Poly>::type>::type;
+		using MPoly = typename UPoly::CoeffType;
+		/// If set, projection polynomials that are known to be sign-invariant are not inserted.
+		bool mMinimize;
+	public:
+		/**
+		 * Constructs a projection operator.
+		 * @param minimize If set, factors of constant sign, e.g. definite leading coefficients, are omitted from the projection.
+		 */
+		explicit ProjectionOperator(bool minimize = false): mMinimize(minimize) {}
+
         template<typename Inserter>
         void operator()(ProjectionType pt, const Poly& p, Variable::Arg variable, Inserter& i) const {
             switch (pt) {
 				case ProjectionType::Brown: return Brown(p, variable, i);
                 case ProjectionType::McCallum: return McCallum(p, variable, i);
+                case ProjectionType::Hong: return Hong(p, variable, i);
+                case ProjectionType::Lazard: return Lazard(p, variable, i);
                 default:
                     CARL_LOG_ERROR("carl.cad", "Selected a projection operator that is not implemented.");
                     return;
@@ -27,6 +55,8 @@ namespace cad {
             switch (pt) {
 				case ProjectionType::Brown: return Brown(p, q, variable, i);
                 case ProjectionType::McCallum: return McCallum(p, q, variable, i);
+                case ProjectionType::Hong: return Hong(p, q, variable, i);
+                case ProjectionType::Lazard: return Lazard(p, q, variable, i);
                 default:
                     CARL_LOG_ERROR("carl.cad", "Selected a projection operator that is not implemented.");
                     return;
@@ -48,16 +78,69 @@ namespace cad {
             return false;
         }
 
+		/**
+		 * Inserts a projection polynomial, unless minimization is enabled and the polynomial has a constant sign.
+		 * Such polynomials have no real roots and hence do not contribute to the decomposition.
+		 */
+		template<typename Inserter>
+		void add(const UPoly& r, const std::list<Poly>& parents, Inserter& i) const {
+			if (mMinimize && doesNotVanish(MPoly(r))) {
+				CARL_LOG_DEBUG("carl.cad.projection", "Omitting " << r << " as it has a constant sign.");
+				return;
+			}
+			i.insert(r, parents, false);
+		}
+		/**
+		 * Inserts a coefficient of p, unless minimization is enabled and the coefficient has a constant sign.
+		 */
+		template<typename Inserter>
+		void addCoefficient(const MPoly& coeff, const Poly& p, Variable::Arg variable, Inserter& i) const {
+			if (coeff.isConstant()) return;
+			if (mMinimize && doesNotVanish(coeff)) {
+				CARL_LOG_DEBUG("carl.cad.projection", "Omitting coefficient " << coeff << " as it has a constant sign.");
+				return;
+			}
+			CARL_LOG_DEBUG("carl.cad.projection", "\t-> " << coeff);
+			i.insert(coeff.toUnivariatePolynomial(variable), {p}, false);
+		}
+		/**
+		 * Inserts the leading coefficients of all subresultants of p and q.
+		 * These include all non-zero principal subresultant coefficients, but unlike UnivariatePolynomial::principalSubresultantsCoefficients() this also works for defective subresultant sequences.
+		 */
+		template<typename Inserter>
+		void addPSC(const UPoly& p, const UPoly& q, const std::list<Poly>& parents, Variable::Arg variable, Inserter& i) const {
+			if (p.isZero() || q.isZero()) return;
+			for (const auto& s: UPoly::subresultants(p, q)) {
+				if (s.isZero() || s.lcoeff().isConstant()) continue;
+				CARL_LOG_DEBUG("carl.cad.projection", "psc(" << p << ", " << q << ") -> " << s.lcoeff());
+				add(UPoly(s.mainVar(), s.lcoeff()).switchVariable(variable), parents, i);
+			}
+		}
+		/**
+		 * Computes the reducta of p, that is p and the polynomials obtained by successively removing the leading term, down to degree one.
+		 */
+		std::vector<UPoly> reducta(const UPoly& p) const {
+			std::vector<UPoly> res;
+			UPoly cur = p;
+			while (!cur.isZero() && cur.degree() > 0) {
+				res.push_back(cur);
+				if (mMinimize && doesNotVanish(cur.lcoeff())) break;
+				std::vector<MPoly> coeffs(cur.coefficients().begin(), cur.coefficients().end() - 1);
+				cur = UPoly(cur.mainVar(), coeffs);
+			}
+			return res;
+		}
+
 		template<typename Inserter>
 		void Brown(const Poly& p, const Poly& q, Variable::Arg variable, Inserter& i) const {
 			CARL_LOG_DEBUG("carl.cad.projection", "resultant(" << p << ", " << q << ")");
-			i.insert(p->resultant(*q).switchVariable(variable), {p, q}, false);
+			add(p->resultant(*q).switchVariable(variable), {p, q}, i);
 		}
 		template<typename Inserter>
 		void Brown(const Poly& p, Variable::Arg variable, Inserter& i) const {
 			// Insert discriminant
 			CARL_LOG_DEBUG("carl.cad.projection", "discriminant(" << p << ")");
-			i.insert(p->discriminant().switchVariable(variable), {p}, false);
+			add(p->discriminant().switchVariable(variable), {p}, i);
 			if (doesNotVanish(p->lcoeff())) {
 				CARL_LOG_DEBUG("carl.cad.projection", "lcoeff = " << p->lcoeff() << " does not vanish. No further polynomials needed.");
 				return;
@@ -65,33 +148,91 @@ namespace cad {
 			for (const auto& coeff: p->coefficients()) {
 				if (doesNotVanish(coeff)) {
 					CARL_LOG_DEBUG("carl.cad.projection", "coeff " << coeff << " does not vanish. We only need the lcoeff()");
-					i.insert(p->lcoeff().toUnivariatePolynomial(variable), {p}, false);
+					addCoefficient(p->lcoeff(), p, variable, i);
 					return;
 				}
 			}
 			CARL_LOG_DEBUG("carl.cad.projection", "All coefficients might vanish, we need all of them.");
 			for (const auto& coeff: p->coefficients()) {
-				if (coeff.isConstant()) continue;
-				CARL_LOG_DEBUG("carl.cad.projection", "\t-> " << coeff);
-				i.insert(coeff.toUnivariatePolynomial(variable), {p}, false);
+				addCoefficient(coeff, p, variable, i);
 			}
 		}
         template<typename Inserter>
         void McCallum(const Poly& p, const Poly& q, Variable::Arg variable, Inserter& i) const {
 			CARL_LOG_DEBUG("carl.cad.projection", "resultant(" << p << ", " << q << ")");
-            i.insert(p->resultant(*q).switchVariable(variable), {p, q}, false);
+			add(p->resultant(*q).switchVariable(variable), {p, q}, i);
         }
         template<typename Inserter>
         void McCallum(const Poly& p, Variable::Arg variable, Inserter& i) const {
             // Insert discriminant
 			CARL_LOG_DEBUG("carl.cad.projection", "discriminant(" << p << ")");
-            i.insert(p->discriminant().switchVariable(variable), {p}, false);
+			add(p->discriminant().switchVariable(variable), {p}, i);
             for (const auto& coeff: p->coefficients()) {
-				if (coeff.isConstant()) continue;
-				CARL_LOG_DEBUG("carl.cad.projection", "\t-> " << coeff);
-                i.insert(coeff.toUnivariatePolynomial(variable), {p}, false);
+				addCoefficient(coeff, p, variable, i);
             }
         }
+		/**
+		 * Paired part of Hong's projection: the principal subresultant coefficients of all reducta of p with q.
+		 */
+		template<typename Inserter>
+		void Hong(const Poly& p, const Poly& q, Variable::Arg variable, Inserter& i) const {
+			CARL_LOG_DEBUG("carl.cad.projection", "Hong(" << p << ", " << q << ")");
+			for (const auto& r: reducta(*p)) {
+				addPSC(r, *q, {p, q}, variable, i);
+			}
+		}
+		/**
+		 * Single part of Hong's projection: for all reducta r of p the leading coefficient of r and the principal subresultant coefficients of r and its derivative.
+		 */
+		template<typename Inserter>
+		void Hong(const Poly& p, Variable::Arg variable, Inserter& i) const {
+			CARL_LOG_DEBUG("carl.cad.projection", "Hong(" << p << ")");
+			for (const auto& r: reducta(*p)) {
+				addCoefficient(r.lcoeff(), p, variable, i);
+				if (r.degree() > 1) addPSC(r, r.derivative(), {p}, variable, i);
+			}
+		}
+		/**
+		 * Paired part of Lazard's projection: the resultant of p and q.
+		 */
+		template<typename Inserter>
+		void Lazard(const Poly& p, const Poly& q, Variable::Arg variable, Inserter& i) const {
+			CARL_LOG_DEBUG("carl.cad.projection", "resultant(" << p << ", " << q << ")");
+			add(p->resultant(*q).switchVariable(variable), {p, q}, i);
+		}
+		/**
+		 * Single part of Lazard's projection: the discriminant, the leading and the trailing coefficient of p.
+		 * Omitting the remaining coefficients is only sound with Lazard's valuation in the lifting, which is not implemented:
+		 * the lifting skips polynomials vanishing identically over a sample.
+		 * Hence, unless some coefficient of p has a constant sign, i.e. p can not vanish identically,
+		 * all coefficients are inserted just like in McCallum's projection.
+		 */
+		template<typename Inserter>
+		void Lazard(const Poly& p, Variable::Arg variable, Inserter& i) const {
+			CARL_LOG_DEBUG("carl.cad.projection", "discriminant(" << p << ")");
+			add(p->discriminant().switchVariable(variable), {p}, i);
+			bool mayVanish = true;
+			for (const auto& coeff: p->coefficients()) {
+				if (doesNotVanish(coeff)) {
+					mayVanish = false;
+					break;
+				}
+			}
+			if (mayVanish) {
+				CARL_LOG_DEBUG("carl.cad.projection", p << " may vanish identically, we need all coefficients.");
+				for (const auto& coeff: p->coefficients()) {
+					addCoefficient(coeff, p, variable, i);
+				}
+				return;
+			}
+			addCoefficient(p->lcoeff(), p, variable, i);
+			// trailing coefficient
+			for (std::size_t k = 0; k < p->degree(); k++) {
+				if (p->coefficients()[k].isZero()) continue;
+				addCoefficient(p->coefficients()[k], p, variable, i);
+				break;
+			}
+		}
     };
 
 }
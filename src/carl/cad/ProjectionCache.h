@@ -0,0 +1,237 @@
+/**
+ * @file ProjectionCache.h
+ * @ingroup cad
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../core/logging.h"
+#include "../core/Variable.h"
+#include "../util/hash.h"
+#include "../util/Singleton.h"
+
+#include "CADTypes.h"
+#include "Projection.h"
+
+namespace carl {
+namespace cad {
+
+/**
+ * A map with a bounded number of entries that evicts the least recently used entry if it is full.
+ */
+template<typename Key, typename Value, typename Hash = std::hash<Key>>
+class LRUMap {
+private:
+	using Entry = std::pair<Key, Value>;
+	/// Entries, the most recently used one first.
+	std::list<Entry> mEntries;
+	/// Maps keys to their entry.
+	std::unordered_map<Key, typename std::list<Entry>::iterator, Hash> mIndex;
+	/// Maximum number of entries.
+	std::size_t mCapacity;
+public:
+	explicit LRUMap(std::size_t capacity): mEntries(), mIndex(), mCapacity(capacity) {}
+
+	/**
+	 * Looks up the given key and marks the entry as most recently used.
+	 * @param key Key.
+	 * @return Pointer to the value or nullptr, valid until the next modification.
+	 */
+	const Value* get(const Key& key) {
+		auto it = mIndex.find(key);
+		if (it == mIndex.end()) return nullptr;
+		mEntries.splice(mEntries.begin(), mEntries, it->second);
+		return &it->second->second;
+	}
+	/**
+	 * Stores the value for the given key, replacing an existing value.
+	 * @param key Key.
+	 * @param value Value.
+	 */
+	void put(const Key& key, Value&& value) {
+		auto it = mIndex.find(key);
+		if (it != mIndex.end()) {
+			it->second->second = std::move(value);
+			mEntries.splice(mEntries.begin(), mEntries, it->second);
+			return;
+		}
+		if (mCapacity == 0) return;
+		mEntries.emplace_front(key, std::move(value));
+		mIndex.emplace(key, mEntries.begin());
+		shrink();
+	}
+	void setCapacity(std::size_t capacity) {
+		mCapacity = capacity;
+		shrink();
+	}
+	std::size_t capacity() const {
+		return mCapacity;
+	}
+	std::size_t size() const {
+		return mEntries.size();
+	}
+	void clear() {
+		mIndex.clear();
+		mEntries.clear();
+	}
+private:
+	void shrink() {
+		while (mEntries.size() > mCapacity) {
+			mIndex.erase(mEntries.back().first);
+			mEntries.pop_back();
+		}
+	}
+};
+
+/**
+ * Process-wide cache for projection results.
+ *
+ * Many CAD objects are usually built over overlapping sets of polynomials, for example by an SMT solver that repeatedly checks similar sets of constraints.
+ * This cache stores the results of the projection operators, i.e. resultants, discriminants and coefficients, as well as the primitive square-free parts of projection polynomials, independent of any CAD object.
+ * Projections are identified by the projection operator, the normalized polynomials and the variable of the next level.
+ * Both tables are bounded and evict the least recently used entries.
+ */
+template<typename Number>
+class ProjectionCache: public Singleton<ProjectionCache<Number>> {
+	friend Singleton<ProjectionCache<Number>>;
+public:
+	using Polynomial = UPolynomial<Number>;
+
+	/**
+	 * Identifies the projection of a single polynomial or a pair of polynomials.
+	 */
+	struct Key {
+		ProjectionType type;
+		bool minimize;
+		Variable variable;
+		Polynomial p;
+		Polynomial q;
+		bool paired;
+
+		Key(ProjectionType t, bool m, Variable::Arg v, const Polynomial& _p):
+			type(t), minimize(m), variable(v), p(_p.normalized()), q(_p.mainVar()), paired(false)
+		{}
+		Key(ProjectionType t, bool m, Variable::Arg v, const Polynomial& _p, const Polynomial& _q):
+			type(t), minimize(m), variable(v), p(_p.normalized()), q(_q.normalized()), paired(true)
+		{}
+		bool operator==(const Key& k) const {
+			return type == k.type && minimize == k.minimize && variable == k.variable && paired == k.paired && p == k.p && q == k.q;
+		}
+	};
+	struct KeyHash {
+		std::size_t operator()(const Key& k) const {
+			std::size_t res = 0;
+			carl::hash_add(res, static_cast<std::size_t>(k.type), static_cast<std::size_t>(k.minimize), k.variable, k.p, k.q);
+			return res;
+		}
+	};
+private:
+	LRUMap<Key, std::vector<Polynomial>, KeyHash> mProjections;
+	LRUMap<Polynomial, Polynomial> mSimplifications;
+	std::size_t mHits;
+	std::size_t mMisses;
+	mutable std::mutex mMutex;
+
+	#ifdef THREAD_SAFE
+	#define PROJECTION_CACHE_LOCK_GUARD std::lock_guard<std::mutex> lock(mMutex);
+	#else
+	#define PROJECTION_CACHE_LOCK_GUARD
+	#endif
+protected:
+	ProjectionCache(): mProjections(4096), mSimplifications(4096), mHits(0), mMisses(0) {}
+public:
+	/**
+	 * Retrieves the projection results for the given key.
+	 * @param key Projection.
+	 * @param results Receives the projection results.
+	 * @return True if the results were cached.
+	 */
+	bool getProjection(const Key& key, std::vector<Polynomial>& results) {
+		PROJECTION_CACHE_LOCK_GUARD
+		const auto* res = mProjections.get(key);
+		if (res == nullptr) {
+			mMisses++;
+			return false;
+		}
+		mHits++;
+		results = *res;
+		return true;
+	}
+	/**
+	 * Stores the projection results for the given key.
+	 * @param key Projection.
+	 * @param results Projection results.
+	 */
+	void putProjection(const Key& key, std::vector<Polynomial> results) {
+		PROJECTION_CACHE_LOCK_GUARD
+		mProjections.put(key, std::move(results));
+	}
+	/**
+	 * Returns the primitive square-free part of the given projection polynomial.
+	 * @param p Projection polynomial.
+	 * @return p.pseudoPrimpart().squareFreePart()
+	 */
+	Polynomial simplify(const Polynomial& p) {
+		{
+			PROJECTION_CACHE_LOCK_GUARD
+			const auto* res = mSimplifications.get(p);
+			if (res != nullptr) return *res;
+		}
+		// computed without holding the lock
+		Polynomial res = p.pseudoPrimpart().squareFreePart();
+		PROJECTION_CACHE_LOCK_GUARD
+		mSimplifications.put(p, Polynomial(res));
+		return res;
+	}
+
+	/**
+	 * Sets the maximum number of entries of both tables.
+	 * @param capacity Maximum number of entries, zero disables the cache.
+	 */
+	void setCapacity(std::size_t capacity) {
+		PROJECTION_CACHE_LOCK_GUARD
+		mProjections.setCapacity(capacity);
+		mSimplifications.setCapacity(capacity);
+	}
+	/**
+	 * @return Number of cached projections.
+	 */
+	std::size_t size() const {
+		PROJECTION_CACHE_LOCK_GUARD
+		return mProjections.size();
+	}
+	/**
+	 * @return Number of projection lookups that were answered by the cache.
+	 */
+	std::size_t hits() const {
+		PROJECTION_CACHE_LOCK_GUARD
+		return mHits;
+	}
+	/**
+	 * @return Number of projection lookups that were not answered by the cache.
+	 */
+	std::size_t misses() const {
+		PROJECTION_CACHE_LOCK_GUARD
+		return mMisses;
+	}
+	/**
+	 * Removes all entries and resets the statistics.
+	 */
+	void clear() {
+		PROJECTION_CACHE_LOCK_GUARD
+		mProjections.clear();
+		mSimplifications.clear();
+		mHits = 0;
+		mMisses = 0;
+	}
+};
+
+}
+}
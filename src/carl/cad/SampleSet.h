@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <iostream>
 #include <list>
+#include <mutex>
 #include <queue>
 #include <unordered_map>
 #include <utility>
@@ -133,13 +134,97 @@ public:
 	std::set<RealAlgebraicNumber<Number>> mSamples;
 
 	SampleComparator mComp;
-	std::vector<RealAlgebraicNumber<Number>> mHeap;
-	
+	/// Binary heap of references into mSamples, ordered by mComp.
+	std::vector<Iterator> mHeap;
+	/// Position of every sample within mHeap, allows to remove arbitrary samples in logarithmic time.
+	std::unordered_map<const RealAlgebraicNumber<Number>*, std::size_t> mHeapPositions;
+	/// Serializes modifications if carl is built with THREAD_SAFE.
+	mutable std::recursive_mutex mMutex;
+
+	#ifdef THREAD_SAFE
+	#define SAMPLESET_LOCK_GUARD std::lock_guard<std::recursive_mutex> lock(mMutex);
+	#else
+	#define SAMPLESET_LOCK_GUARD
+	#endif
+
+	/**
+	 * Swaps two heap entries and updates their positions.
+	 */
+	void heapSwap(std::size_t lhs, std::size_t rhs) {
+		std::swap(mHeap[lhs], mHeap[rhs]);
+		mHeapPositions[&*mHeap[lhs]] = lhs;
+		mHeapPositions[&*mHeap[rhs]] = rhs;
+	}
+	/**
+	 * Moves the heap entry at the given position upwards until the heap property holds.
+	 */
+	void siftUp(std::size_t pos) {
+		while (pos > 0) {
+			std::size_t parent = (pos - 1) / 2;
+			if (!mComp(*mHeap[parent], *mHeap[pos])) break;
+			heapSwap(parent, pos);
+			pos = parent;
+		}
+	}
+	/**
+	 * Moves the heap entry at the given position downwards until the heap property holds.
+	 */
+	void siftDown(std::size_t pos) {
+		while (true) {
+			std::size_t largest = pos;
+			std::size_t left = 2 * pos + 1;
+			std::size_t right = left + 1;
+			if (left < mHeap.size() && mComp(*mHeap[largest], *mHeap[left])) largest = left;
+			if (right < mHeap.size() && mComp(*mHeap[largest], *mHeap[right])) largest = right;
+			if (largest == pos) break;
+			heapSwap(pos, largest);
+			pos = largest;
+		}
+	}
+	/**
+	 * Adds a sample from mSamples to the heap.
+	 * @param it Iterator to the sample.
+	 * @complexity logarithmic in the number of samples
+	 */
+	void heapInsert(Iterator it) {
+		mHeapPositions[&*it] = mHeap.size();
+		mHeap.push_back(it);
+		siftUp(mHeap.size() - 1);
+	}
+	/**
+	 * Removes a sample from the heap, but not from mSamples.
+	 * @param it Iterator to the sample.
+	 * @complexity logarithmic in the number of samples
+	 */
+	void heapRemove(Iterator it) {
+		auto posIt = mHeapPositions.find(&*it);
+		assert(posIt != mHeapPositions.end());
+		std::size_t pos = posIt->second;
+		mHeapPositions.erase(posIt);
+		if (pos + 1 != mHeap.size()) {
+			mHeap[pos] = mHeap.back();
+			mHeapPositions[&*mHeap[pos]] = pos;
+		}
+		mHeap.pop_back();
+		if (pos < mHeap.size()) {
+			siftDown(pos);
+			siftUp(pos);
+		}
+	}
 	/**
 	 * Restore the ordering.
      */
 	void restoreOrdering() {
-		std::make_heap(mHeap.begin(), mHeap.end(), mComp);
+		mHeap.clear();
+		mHeapPositions.clear();
+		mHeap.reserve(mSamples.size());
+		for (auto it = mSamples.begin(); it != mSamples.end(); it++) {
+			mHeapPositions[&*it] = mHeap.size();
+			mHeap.push_back(it);
+		}
+		for (std::size_t i = mHeap.size() / 2; i > 0; i--) {
+			siftDown(i - 1);
+		}
 	}
 	/**
 	 * Reset the ordering.
@@ -157,11 +242,45 @@ public:
 	{
 		CARL_LOG_TRACE("carl.cad.sampleset", this << " " << __func__ << "( " << ordering << " )");
 	}
-	
-	const std::vector<RealAlgebraicNumber<Number>>& getHeap() const {
-		return mHeap;
+	/**
+	 * Copy constructor.
+	 * The heap refers to the samples by iterators and is thus rebuilt for the copy.
+	 * @param s Other SampleSet.
+	 */
+	SampleSet(const SampleSet& s):
+		mSamples(s.mSamples),
+		mComp(s.mComp)
+	{
+		restoreOrdering();
 	}
+	/**
+	 * Move constructor.
+	 * Iterators into mSamples stay valid when moving, hence the heap can be moved as well.
+	 */
+	SampleSet(SampleSet&& s):
+		mSamples(std::move(s.mSamples)),
+		mComp(s.mComp),
+		mHeap(std::move(s.mHeap)),
+		mHeapPositions(std::move(s.mHeapPositions))
+	{}
 
+	SampleSet& operator=(const SampleSet& s) {
+		if (this == &s) return *this;
+		SAMPLESET_LOCK_GUARD
+		mSamples = s.mSamples;
+		mComp = s.mComp;
+		restoreOrdering();
+		return *this;
+	}
+	SampleSet& operator=(SampleSet&& s) {
+		SAMPLESET_LOCK_GUARD
+		mSamples = std::move(s.mSamples);
+		mComp = s.mComp;
+		mHeap = std::move(s.mHeap);
+		mHeapPositions = std::move(s.mHeapPositions);
+		return *this;
+	}
+	
 	/**
 	 * Returns the current ordering.
 	 * @return Ordering.
@@ -181,6 +300,7 @@ public:
 	/**
 	 * Insert a new sample into this sample set.
 	 * If a sample of this value was already present, it takes care of updating the sample (in case the new one is numeric or a root).
+	 * If carl is built with THREAD_SAFE, concurrent insertions are serialized.
      * @param r Sample to insert.
      * @return An iterator to the inserted sample, a flag that indicates if the insertion changed something and a flag that indicates if a value has been replaced or was new altogether.
      */
@@ -217,11 +337,9 @@ public:
 	SampleSet::Iterator remove(SampleSet::Iterator position) {
 #endif
 		assert(position != mSamples.end());
+		SAMPLESET_LOCK_GUARD
 		CARL_LOG_TRACE("carl.cad.sampleset", this << " " << __func__ << "( " << *position << " )");
-		auto it = std::find(mHeap.begin(), mHeap.end(), *position);
-		std::swap(*it, mHeap.back());
-		mHeap.pop_back();
-		restoreOrdering();
+		heapRemove(position);
 		auto res = mSamples.erase(position);
 		assert(this->isConsistent());
 		return res;
@@ -278,8 +396,9 @@ public:
 	 * @return Next sample.
 	 */
 	inline RealAlgebraicNumber<Number> next() const {
+		SAMPLESET_LOCK_GUARD
 		assert(!mHeap.empty());
-		return mHeap.front();
+		return *mHeap.front();
 	}
 
 	/**
@@ -287,6 +406,7 @@ public:
 	 * @return True, if next sample is optimal.
 	 */
 	inline bool hasOptimal() const {
+		SAMPLESET_LOCK_GUARD
 		if (mHeap.empty()) return false;
 		return mComp.isOptimal(next());
 	}
@@ -297,13 +417,14 @@ public:
      * @return Next sample.
      */
 	inline RealAlgebraicNumber<Number> next(SampleOrdering ordering) {
+		SAMPLESET_LOCK_GUARD
 		this->restoreOrdering(ordering);
 		return this->next();
 	}
 
 	/**
 	 * Removes the element returned by next() from the list.
-	 * @complexity at most linear in the size of the list
+	 * @complexity logarithmic in the size of the list
 	 */
 	void pop();
 	
@@ -340,6 +461,7 @@ public:
      * @return True, if no sample is left.
      */
 	bool empty() const {
+		SAMPLESET_LOCK_GUARD
 		return mHeap.empty();
 	}
 	
@@ -366,7 +488,7 @@ private:
 	/**
 	 * Checks if this sample set fulfills the following conditions:
 	 * <ul>
-	 * <li>mSamples and mQueue contain the same samples.</li>
+	 * <li>mSamples and mHeap contain the same samples and mHeapPositions stores their positions in mHeap.</li>
 	 * <li>The samples in mSamples are ordered by their value.</li>
 	 * </ul>
 	 * @return True, if this SampleSet is consistent.
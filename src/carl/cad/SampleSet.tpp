@@ -82,6 +82,7 @@ bool SampleSet<Number>::SampleComparator::isOptimal(const RealAlgebraicNumber<Nu
 
 template<typename Number>
 std::tuple<typename SampleSet<Number>::Iterator, bool, bool> SampleSet<Number>::insert(const RealAlgebraicNumber<Number>& r) {
+	SAMPLESET_LOCK_GUARD
 	CARL_LOG_TRACE("carl.cad.sampleset", this << " " << __func__ << "( " << r << " )");
 	CARL_LOG_TRACE("carl.cad.sampleset", *this);
 	assert(this->isConsistent());
@@ -89,8 +90,7 @@ std::tuple<typename SampleSet<Number>::Iterator, bool, bool> SampleSet<Number>::
 	auto result = std::make_tuple(res.first, res.second, false);
 	CARL_LOG_TRACE("carl.cad.sampleset", "\tinsert(): " << *res.first << ", " << res.second);
 	if (res.second) {
-		mHeap.push_back(r);
-		std::push_heap(mHeap.begin(), mHeap.end(), mComp);
+		heapInsert(res.first);
 	} else if (!(*res.first).isRoot() && r.isRoot()) {
 		this->remove(res.first);
 		std::get<0>(result) = std::get<0>(this->insert(r));
@@ -107,23 +107,26 @@ std::tuple<typename SampleSet<Number>::Iterator, bool, bool> SampleSet<Number>::
 
 template<typename Number>
 void SampleSet<Number>::pop() {
+	SAMPLESET_LOCK_GUARD
 	CARL_LOG_TRACE("carl.cad.sampleset", this << " " << __func__ << "()");
 	if (this->mHeap.empty()) return;
-	this->mSamples.erase(mHeap.front());
-	std::pop_heap(mHeap.begin(), mHeap.end(), mComp);
-	mHeap.pop_back();
+	auto it = mHeap.front();
+	heapRemove(it);
+	this->mSamples.erase(it);
 	assert(this->isConsistent());
 }
 
 template<typename Number>
 bool SampleSet<Number>::simplify(const RealAlgebraicNumber<Number>& from, RealAlgebraicNumber<Number>& to) {
+	SAMPLESET_LOCK_GUARD
 	CARL_LOG_TRACE("carl.cad.sampleset", this << " " << __func__ << "( " << from << " -> " << to << " )");
 	assert(this->isConsistent());
-	if (mSamples.count(from) > 0) {
-		mSamples.erase(from);
-		mSamples.insert(to);
-		auto it = std::find(mHeap.begin(), mHeap.end(), from);
-		*it = to;
+	auto it = mSamples.find(from);
+	if (it != mSamples.end()) {
+		heapRemove(it);
+		mSamples.erase(it);
+		auto res = mSamples.insert(to);
+		if (res.second) heapInsert(res.first);
 		assert(this->isConsistent());
 		return true;
 	}
@@ -132,6 +135,7 @@ bool SampleSet<Number>::simplify(const RealAlgebraicNumber<Number>& from, RealAl
 
 template<typename Number>
 std::pair<typename SampleSet<Number>::SampleSimplification, bool> SampleSet<Number>::simplify(bool fast) {
+	SAMPLESET_LOCK_GUARD
 	CARL_LOG_TRACE("carl.cad.sampleset", this << " " << __func__ << "()");
 	std::pair<SampleSimplification, bool> simplification;
 	if (this->empty()) return simplification;
@@ -168,15 +172,17 @@ template<typename Number>
 bool SampleSet<Number>::isConsistent() const {
 	CARL_LOG_TRACE("carl.cad.sampleset", this << " " << __func__ << "()");
 	CARL_LOG_TRACE("carl.cad.sampleset", "samples: " << mSamples);
-	CARL_LOG_TRACE("carl.cad.sampleset", "heap:    " << mHeap);
-	std::set<RealAlgebraicNumber<Number>> queue(mHeap.begin(), mHeap.end());
-	for (auto n: this->mSamples) {
-		auto it = queue.find(n);
-		if (it == queue.end()) {
-			CARL_LOG_ERROR("carl.cad.sampleset", "Sample " << n << " is not in queue.");
-			assert(queue.find(n) != queue.end());
+	if (mHeap.size() != mSamples.size() || mHeapPositions.size() != mSamples.size()) {
+		CARL_LOG_ERROR("carl.cad.sampleset", "Heap holds " << mHeap.size() << " samples, but there are " << mSamples.size() << " samples.");
+		assert(mHeap.size() == mSamples.size());
+		assert(mHeapPositions.size() == mSamples.size());
+	}
+	for (std::size_t i = 0; i < mHeap.size(); i++) {
+		auto it = mHeapPositions.find(&*mHeap[i]);
+		if (it == mHeapPositions.end() || it->second != i) {
+			CARL_LOG_ERROR("carl.cad.sampleset", "Sample " << *mHeap[i] << " has an invalid heap position.");
+			assert(it != mHeapPositions.end() && it->second == i);
 		}
-		queue.erase(it);
 	}
 	RealAlgebraicNumber<Number> lastSample;
 	bool first = true;
@@ -189,10 +195,6 @@ bool SampleSet<Number>::isConsistent() const {
 		lastSample = n;
 		first = false;
 	}
-	if (!queue.empty()) {
-		CARL_LOG_ERROR("carl.cad.sampleset", "Additional samples in queue: " << queue);
-		assert(queue.empty());
-	}
 	return true;
 }
 
@@ -200,7 +202,9 @@ bool SampleSet<Number>::isConsistent() const {
 template<typename Num>
 void swap(carl::cad::SampleSet<Num>& lhs, carl::cad::SampleSet<Num>& rhs) {
 	std::swap(lhs.mSamples, rhs.mSamples);
+	std::swap(lhs.mComp, rhs.mComp);
 	std::swap(lhs.mHeap, rhs.mHeap);
+	std::swap(lhs.mHeapPositions, rhs.mHeapPositions);
 }
 #endif
 
@@ -213,7 +217,9 @@ namespace std {
 template<typename Num>
 void swap(carl::cad::SampleSet<Num>& lhs, carl::cad::SampleSet<Num>& rhs) {
 	std::swap(lhs.mSamples, rhs.mSamples);
+	std::swap(lhs.mComp, rhs.mComp);
 	std::swap(lhs.mHeap, rhs.mHeap);
+	std::swap(lhs.mHeapPositions, rhs.mHeapPositions);
 }
 
 }
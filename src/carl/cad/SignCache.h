@@ -0,0 +1,109 @@
+/**
+ * @file SignCache.h
+ * @ingroup cad
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <unordered_map>
+#include <utility>
+
+#include "../core/Sign.h"
+#include "../util/hash.h"
+
+#include "CADTypes.h"
+
+namespace carl {
+namespace cad {
+
+/**
+ * Stores the signs of constraint polynomials at the nodes of a sample tree.
+ *
+ * The sign of a polynomial only depends on the sample components of its variables.
+ * Hence, the sign is stored at the sample tree node of the lowest depth where all these variables are assigned, and all samples below this node share it.
+ * Polynomials are identified by an ID, such that constraints with the same polynomial, e.g. p < 0 and p = 0, share their signs as well.
+ *
+ * Node IDs are reused by the sample tree, therefore the cache has to be invalidated whenever nodes are erased.
+ */
+template<typename Number>
+class SignCache {
+private:
+	using Key = std::pair<std::size_t, std::size_t>;
+	struct KeyHash {
+		std::size_t operator()(const Key& k) const {
+			std::size_t res = 0;
+			carl::hash_add(res, k.first, k.second);
+			return res;
+		}
+	};
+	/// Maps polynomials to their IDs.
+	std::unordered_map<MPolynomial<Number>, std::size_t> mPolynomials;
+	/// Maps pairs of node ID and polynomial ID to the sign.
+	std::unordered_map<Key, Sign, KeyHash> mSigns;
+	std::size_t mHits = 0;
+	std::size_t mMisses = 0;
+public:
+	/**
+	 * Returns the ID of the given polynomial.
+	 * @param p Polynomial.
+	 * @return ID of p.
+	 */
+	std::size_t polynomial(const MPolynomial<Number>& p) {
+		return mPolynomials.emplace(p, mPolynomials.size()).first->second;
+	}
+	/**
+	 * Retrieves the sign of a polynomial at a node.
+	 * @param node Node ID.
+	 * @param polynomial Polynomial ID.
+	 * @param sign Receives the sign.
+	 * @return If the sign was cached.
+	 */
+	bool get(std::size_t node, std::size_t polynomial, Sign& sign) {
+		auto it = mSigns.find(Key(node, polynomial));
+		if (it == mSigns.end()) {
+			mMisses++;
+			return false;
+		}
+		mHits++;
+		sign = it->second;
+		return true;
+	}
+	/**
+	 * Stores the sign of a polynomial at a node.
+	 * @param node Node ID.
+	 * @param polynomial Polynomial ID.
+	 * @param sign Sign.
+	 */
+	void put(std::size_t node, std::size_t polynomial, Sign sign) {
+		mSigns[Key(node, polynomial)] = sign;
+	}
+	/**
+	 * Removes all signs, to be called whenever nodes of the sample tree are erased.
+	 * The polynomial IDs are kept.
+	 */
+	void invalidate() {
+		mSigns.clear();
+	}
+	/**
+	 * @return Number of cached signs.
+	 */
+	std::size_t size() const {
+		return mSigns.size();
+	}
+	/**
+	 * @return Number of lookups answered by the cache.
+	 */
+	std::size_t hits() const {
+		return mHits;
+	}
+	/**
+	 * @return Number of lookups not answered by the cache.
+	 */
+	std::size_t misses() const {
+		return mMisses;
+	}
+};
+
+}
+}
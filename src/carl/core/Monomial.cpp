@@ -388,6 +388,32 @@ namespace carl
 		return CompareResult::LESS;
 	}
 	
+	CompareResult Monomial::reverseLexicalCompare(const Monomial& lhs, const Monomial& rhs)
+	{
+		assert(lhs.tdeg() == rhs.tdeg());
+		if (lhs.id() == rhs.id()) return CompareResult::EQUAL;
+		auto lhsit = lhs.mExponents.rbegin();
+		auto rhsit = rhs.mExponents.rbegin();
+		auto lhsend = lhs.mExponents.rend();
+		auto rhsend = rhs.mExponents.rend();
+		while (lhsit != lhsend && rhsit != rhsend) {
+			if (lhsit->first == rhsit->first) {
+				if (lhsit->second < rhsit->second)
+					return CompareResult::GREATER;
+				if (lhsit->second > rhsit->second)
+					return CompareResult::LESS;
+			} else {
+				// The monomial with the smaller variable has a positive exponent where the other one has none.
+				return (lhsit->first > rhsit->first) ? CompareResult::LESS : CompareResult::GREATER;
+			}
+			++lhsit;
+			++rhsit;
+		}
+		// Monomials of the same total degree can not be a proper prefix of each other.
+		assert(lhsit == lhsend && rhsit == rhsend);
+		return CompareResult::EQUAL;
+	}
+	
 	Monomial::Arg operator*(const Monomial::Arg& lhs, const Monomial::Arg& rhs)
 	{
 		CARL_LOG_FUNC("carl.core.monomial", lhs << ", " << rhs);
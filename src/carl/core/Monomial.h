@@ -500,6 +500,14 @@ namespace carl
 		}
 
 
+		/**
+		 * Compares two monomials by their total degree, monomials of higher total degree are greater.
+		 * Monomials of the same total degree are compared by lexicalCompare, which scans the variables starting with the smallest id.
+		 * At the first variable where the exponents differ, the monomial with the larger exponent is smaller.
+		 * @param lhs First monomial.
+		 * @param rhs Second monomial.
+		 * @return Comparison result.
+		 */
 		static CompareResult compareGradedLexical(const Monomial::Arg& lhs, const Monomial::Arg& rhs)
 		{
 			if( !lhs && !rhs )
@@ -523,6 +531,37 @@ namespace carl
 			return CompareResult::EQUAL;
 		}
 
+		/**
+		 * Compares two monomials with respect to the graded reverse lexicographical ordering.
+		 * Monomials of higher total degree are greater.
+		 * Otherwise, the monomial with the smaller exponent of the smallest variable where the exponents differ is greater.
+		 * As for lexicalCompare, variables with smaller ids are larger.
+		 * @param lhs First monomial.
+		 * @param rhs Second monomial.
+		 * @return Comparison result.
+		 */
+		static CompareResult compareGradedReverseLexical(const Monomial::Arg& lhs, const Monomial::Arg& rhs)
+		{
+			if( !lhs && !rhs )
+				return CompareResult::EQUAL;
+			if( !lhs )
+				return CompareResult::LESS;
+			if( !rhs )
+				return CompareResult::GREATER;
+			if(lhs->mTotalDegree < rhs->mTotalDegree) return CompareResult::LESS;
+			if(lhs->mTotalDegree > rhs->mTotalDegree) return CompareResult::GREATER;
+			return reverseLexicalCompare(*lhs, *rhs);
+		}
+
+		static CompareResult compareGradedReverseLexical(const Monomial::Arg& lhs, Variable::Arg rhs)
+		{
+			if(!lhs) return CompareResult::LESS;
+			if(lhs->mTotalDegree > 1) return CompareResult::GREATER;
+			if(lhs->mExponents.front().first < rhs) return CompareResult::GREATER;
+			if(lhs->mExponents.front().first > rhs) return CompareResult::LESS;
+			return CompareResult::EQUAL;
+		}
+
 		/**
 		 * Returns the string representation of this monomial.
 		 * @param infix Flag if prefix or infix notation should be used.
@@ -597,6 +636,15 @@ namespace carl
 		 */
 		static CompareResult lexicalCompare(const Monomial& lhs, const Monomial& rhs);
 
+		/**
+		 * This method compares the exponent vectors of two monomials of the same total degree from the smallest variable on.
+		 * The monomial with the smaller exponent of the first variable where the exponents differ is greater.
+		 * @param lhs First monomial.
+		 * @param rhs Second monomial.
+		 * @return Comparison result.
+		 */
+		static CompareResult reverseLexicalCompare(const Monomial& lhs, const Monomial& rhs);
+
 		/**
 		 * Calculate the hash of a monomial based on its content.
 		 * @param c Content of a monomial.
@@ -8,6 +8,8 @@
 #include "Monomial.h"
 #include "Term.h"
 
+#include <set>
+
 namespace carl 
 {
 
@@ -59,7 +61,96 @@ struct MonomialComparator
 };
 
 
+namespace detail
+{
+	/**
+	 * Compares the parts of two monomials which consist of the variables with Block::contains(v) == inBlock
+	 * with respect to the graded reverse lexicographical ordering, without constructing these parts.
+	 */
+	template<typename Block, bool inBlock>
+	CompareResult compareBlockGradedReverseLexical(const Monomial& lhs, const Monomial& rhs)
+	{
+		exponent lhsDegree = 0;
+		for (const auto& ve: lhs) {
+			if (Block::contains(ve.first) == inBlock) lhsDegree += ve.second;
+		}
+		exponent rhsDegree = 0;
+		for (const auto& ve: rhs) {
+			if (Block::contains(ve.first) == inBlock) rhsDegree += ve.second;
+		}
+		if (lhsDegree < rhsDegree) return CompareResult::LESS;
+		if (lhsDegree > rhsDegree) return CompareResult::GREATER;
+		auto lhsit = lhs.exponents().rbegin();
+		auto rhsit = rhs.exponents().rbegin();
+		auto lhsend = lhs.exponents().rend();
+		auto rhsend = rhs.exponents().rend();
+		while (true) {
+			while (lhsit != lhsend && Block::contains(lhsit->first) != inBlock) ++lhsit;
+			while (rhsit != rhsend && Block::contains(rhsit->first) != inBlock) ++rhsit;
+			if (lhsit == lhsend || rhsit == rhsend) break;
+			if (lhsit->first == rhsit->first) {
+				if (lhsit->second < rhsit->second) return CompareResult::GREATER;
+				if (lhsit->second > rhsit->second) return CompareResult::LESS;
+			} else {
+				return (lhsit->first > rhsit->first) ? CompareResult::LESS : CompareResult::GREATER;
+			}
+			++lhsit;
+			++rhsit;
+		}
+		return CompareResult::EQUAL;
+	}
+
+	/**
+	 * The elimination ordering for the variables of the given block.
+	 * Both blocks are compared by the graded reverse lexicographical ordering.
+	 */
+	template<typename Block>
+	CompareResult compareElimination(const Monomial::Arg& lhs, const Monomial::Arg& rhs)
+	{
+		if( !lhs && !rhs )
+			return CompareResult::EQUAL;
+		if( !lhs )
+			return CompareResult::LESS;
+		if( !rhs )
+			return CompareResult::GREATER;
+		if (lhs->id() == rhs->id()) return CompareResult::EQUAL;
+		CompareResult res = compareBlockGradedReverseLexical<Block, true>(*lhs, *rhs);
+		if (res != CompareResult::EQUAL) return res;
+		return compareBlockGradedReverseLexical<Block, false>(*lhs, *rhs);
+	}
+}
+
 using LexOrdering = MonomialComparator<Monomial::compareLexical, false >;
 using GrLexOrdering = MonomialComparator<Monomial::compareGradedLexical, true >;
-//using GrRevLexOrdering = MonomialComparator<Monomial::GrRevLexCompare, true >;
+using GrRevLexOrdering = MonomialComparator<Monomial::compareGradedReverseLexical, true >;
+
+/**
+ * A block ordering, which eliminates the variables of the given block:
+ * monomials are compared by their parts in the block first, and by the remaining variables afterwards,
+ * both with respect to the graded reverse lexicographical ordering.
+ * Hence, a Groebner basis of an ideal with respect to this ordering contains a Groebner basis of the
+ * elimination ideal, that is, of the polynomials which do not contain any variable of the block.
+ *
+ * The block has to provide `static bool contains(Variable::Arg)`, which must not change while polynomials with this ordering exist.
+ * @ingroup multirp
+ */
+template<typename Block>
+using EliminationOrdering = MonomialComparator<detail::compareElimination<Block>, false >;
+
+/**
+ * A block of variables given by a set, to be used with EliminationOrdering.
+ * Different blocks are distinguished by the Tag.
+ * @ingroup multirp
+ */
+template<typename Tag>
+struct VariableSetBlock
+{
+	static std::set<Variable>& variables() {
+		static std::set<Variable> vars;
+		return vars;
+	}
+	static bool contains(Variable::Arg v) {
+		return variables().count(v) > 0;
+	}
+};
 }
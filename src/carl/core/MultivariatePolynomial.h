@@ -569,6 +569,7 @@ public:
 	bool divides(const MultivariatePolynomial& b) const;
 	/**
 	 * Calculates the S-Polynomial.
+	 * If the polynomials are not monic, the result is scaled by the product of the leading coefficients.
 	 * @param p
 	 * @param q
 	 * @return 
@@ -323,9 +323,12 @@ std::size_t MultivariatePolynomial<Coeff,Ordering,Policies>::totalDegree() const
 	assert(!mTerms.empty());
 	if (Ordering::degreeOrder) {
 		return this->lterm().tdeg();
-	} else {
-		CARL_LOG_NOTIMPLEMENTED();
 	}
+	std::size_t degree = 0;
+	for (const auto& t: mTerms) {
+		degree = std::max(degree, std::size_t(t.tdeg()));
+	}
+	return degree;
 }
 
 template<typename Coeff, typename Ordering, typename Policies>
@@ -365,10 +368,7 @@ bool MultivariatePolynomial<Coeff,Ordering,Policies>::isLinear() const
 	{
 		return this->lterm().isLinear();
 	}
-	else
-	{
-		CARL_LOG_NOTIMPLEMENTED();
-	}
+	return std::all_of(mTerms.begin(), mTerms.end(), [](const Term<Coeff>& t){ return t.isLinear(); });
 }
 
 template<typename Coeff, typename Ordering, typename Policies>
@@ -1344,7 +1344,10 @@ MultivariatePolynomial<Coeff,Ordering,Policies> MultivariatePolynomial<Coeff,Ord
 	}
 	else
 	{
-		return (p.tail() * q.lterm().calcLcmAndDivideBy(p.lmon())) - (q.tail() * p.lterm().calcLcmAndDivideBy( q.lmon() ));
+		// Scaled by the leading coefficients, such that the leading terms cancel for non-monic polynomials as well.
+		TermType pFactor = q.lterm().calcLcmAndDivideBy(p.lmon());
+		TermType qFactor = p.lterm().calcLcmAndDivideBy(q.lmon());
+		return (p.tail() * TermType(q.lcoeff(), pFactor.monomial())) - (q.tail() * TermType(p.lcoeff(), qFactor.monomial()));
 	}
 }
 
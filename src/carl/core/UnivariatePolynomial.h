@@ -47,6 +47,17 @@ enum class PolynomialComparisonOrder {
 enum class SubresultantStrategy {
 	Generic, Lazard, Ducos, Default = Lazard
 };
+/**
+ * Algorithms for the Taylor shift \f$ p(x) \rightarrow p(x+a) \f$.
+ * - Horner: Classical quadratic scheme.
+ * - DivideAndConquer: Splits the polynomial and uses fast multiplication with precomputed powers of \f$ x+a \f$.
+ * - Convolution: Reduces the shift to a single convolution. Only applicable for exact integral or rational coefficients.
+ * - Automatic: Chooses depending on the degree and the coefficient type.
+ * @see @cite GG97
+ */
+enum class TaylorShiftStrategy {
+	Horner, DivideAndConquer, Convolution, Automatic, Default = Automatic
+};
 	
 /**
  * This class represents a univariate polynomial with coefficients of an arbitrary type.
@@ -920,6 +931,21 @@ public:
 	 * @param root Root to be eliminated.
 	 */
 	void eliminateRoot(const Coefficient& root);
+
+	/**
+	 * Scale the variable, i.e. apply \f$ x \rightarrow factor * x \f$, in place.
+	 * @param factor Factor to scale x.
+	 * @complexity O(n)
+	 */
+	void scale(const Coefficient& factor);
+
+	/**
+	 * Shift the variable by a, i.e. apply \f$ x \rightarrow x + a \f$, in place.
+	 * @param a Offset to shift x.
+	 * @param strategy Algorithm used for the shift.
+	 * @complexity O(n^2) for TaylorShiftStrategy::Horner, O(M(n) log(n)) for the other strategies, where M(n) is the cost of multiplying two polynomials of degree n.
+	 */
+	void shift(const Coefficient& a, TaylorShiftStrategy strategy = TaylorShiftStrategy::Default);
 	
 public:
 	std::list<UnivariatePolynomial> standardSturmSequence() const;
@@ -1177,20 +1203,44 @@ private:
 	void reverse();
 
 	/**
-	 * Scale the variable, i.e. apply \f$ x \rightarrow factor * x \f$
-	 * This method is meant to be called by signVariations only.
-	 * @param factor Factor to scale x.
-	 * @complexity O(n)
+	 * Taylor shift of the given coefficients by a using the classical Horner scheme.
+	 * @param coeffs Coefficients to be shifted in place.
+	 * @param a Offset to shift x.
+	 * @complexity O(n^2)
 	 */
-	void scale(const Coefficient& factor);
+	static void shiftHorner(std::vector<Coefficient>& coeffs, const Coefficient& a);
 
 	/**
-	 * Shift the variable by a, i.e. apply \f$ x \rightarrow x + a \f$
-	 * This method is meant to be called by signVariations only.
+	 * Taylor shift by a using the divide-and-conquer method.
+	 * The coefficients are split in halves of size \f$ 2^i \f$ that are shifted recursively and recombined using the precomputed powers \f$ (x+a)^{2^i} \f$.
 	 * @param a Offset to shift x.
-	 * @complexity O(n^2)
+	 * @complexity O(M(n) log(n))
+	 */
+	void shiftDivideAndConquer(const Coefficient& a);
+
+	/**
+	 * Taylor shift by a using a single convolution.
+	 * With \f$ p = \sum_i p_i x^i \f$, the shifted coefficients are \f$ \frac{1}{k!} \sum_{i \geq k} (i! p_i) \frac{a^{i-k}}{(i-k)!} \f$.
+	 * All intermediate values are scaled by \f$ n! \f$ such that only exact divisions occur, hence this also works for integral coefficients.
+	 * @param a Offset to shift x.
+	 * @complexity O(M(n))
+	 */
+	template<typename C=Coefficient, EnableIf<any<is_subset_of_rationals<C>, is_subset_of_integers<C>>> = dummy>
+	void shiftConvolution(const Coefficient& a);
+	template<typename C=Coefficient, DisableIf<is_subset_of_rationals<C>, is_subset_of_integers<C>> = dummy>
+	void shiftConvolution(const Coefficient& a);
+
+	/**
+	 * Adds the product of the coefficient ranges [lhs, lhs+lsize) and [rhs, rhs+rsize) to res.
+	 * Uses Karatsuba multiplication for large operands and falls back to the schoolbook method for small ones.
+	 * @param lhs First factor.
+	 * @param lsize Number of coefficients of the first factor.
+	 * @param rhs Second factor.
+	 * @param rsize Number of coefficients of the second factor.
+	 * @param res Output range with at least lsize + rsize - 1 coefficients.
 	 */
-	void shift(const Coefficient& a);	
+	static void multiplyCoefficients(const Coefficient* lhs, std::size_t lsize, const Coefficient* rhs, std::size_t rsize, Coefficient* res);
+	static std::vector<Coefficient> multiplyCoefficients(const std::vector<Coefficient>& lhs, const std::vector<Coefficient>& rhs);
 	
 	/**
 	 * Calculates the remainder of polynomial division.
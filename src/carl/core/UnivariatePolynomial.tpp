@@ -1535,19 +1535,177 @@ void UnivariatePolynomial<Coeff>::scale(const Coeff& factor) {
 }
 
 template<typename Coeff>
-void UnivariatePolynomial<Coeff>::shift(const Coeff& a) {
+void UnivariatePolynomial<Coeff>::shift(const Coeff& a, TaylorShiftStrategy strategy) {
+	if (mCoefficients.size() < 2 || a == Coeff(0)) return;
+	if (strategy == TaylorShiftStrategy::Automatic) {
+		// Below this size, the quadratic scheme beats the overhead of the fast methods.
+		const std::size_t hornerThreshold = 32;
+		if (mCoefficients.size() <= hornerThreshold) {
+			strategy = TaylorShiftStrategy::Horner;
+		} else if (is_subset_of_integers<Coeff>::value) {
+			strategy = TaylorShiftStrategy::Convolution;
+		} else {
+			strategy = TaylorShiftStrategy::DivideAndConquer;
+		}
+	}
+	switch (strategy) {
+		case TaylorShiftStrategy::Horner:
+			shiftHorner(mCoefficients, a);
+			break;
+		case TaylorShiftStrategy::DivideAndConquer:
+			shiftDivideAndConquer(a);
+			break;
+		case TaylorShiftStrategy::Convolution:
+			shiftConvolution(a);
+			break;
+		default:
+			assert(false);
+	}
+}
+
+template<typename Coeff>
+void UnivariatePolynomial<Coeff>::shiftHorner(std::vector<Coeff>& coeffs, const Coeff& a) {
+	if (coeffs.size() < 2) return;
 	std::vector<Coeff> next;
-	next.reserve(this->mCoefficients.size());
-	next.push_back(this->mCoefficients.back());
+	next.reserve(coeffs.size());
+	next.push_back(coeffs.back());
 
-	for (std::size_t i = 0; i < this->mCoefficients.size()-1; i++) {
+	for (std::size_t i = 0; i < coeffs.size()-1; i++) {
 		next.push_back(next.back());
 		for (std::size_t j = i; j > 0; j--) {
 			next[j] = a * next[j] + next[j-1];
 		}
-		next[0] = a * next[0] + this->mCoefficients[this->mCoefficients.size()-2-i];
+		next[0] = a * next[0] + coeffs[coeffs.size()-2-i];
+	}
+	coeffs = std::move(next);
+}
+
+template<typename Coeff>
+void UnivariatePolynomial<Coeff>::shiftDivideAndConquer(const Coeff& a) {
+	// Below this size, the subproblems are shifted using the Horner scheme.
+	const std::size_t baseThreshold = 16;
+	std::size_t size = mCoefficients.size();
+	// powers[i] = (x+a)^(2^i)
+	std::vector<std::vector<Coeff>> powers;
+	powers.push_back({a, constant_one<Coeff>::get()});
+	while ((std::size_t(1) << powers.size()) < size) {
+		powers.push_back(multiplyCoefficients(powers.back(), powers.back()));
+	}
+	// Shifts the coefficients [offset, offset+count) with count <= 2^level.
+	std::function<std::vector<Coeff>(std::size_t, std::size_t, std::size_t)> shiftRange = [&](std::size_t offset, std::size_t count, std::size_t level) {
+		if (count <= baseThreshold) {
+			std::vector<Coeff> res(mCoefficients.begin() + long(offset), mCoefficients.begin() + long(offset + count));
+			shiftHorner(res, a);
+			return res;
+		}
+		std::size_t half = std::size_t(1) << (level - 1);
+		if (count <= half) return shiftRange(offset, count, level - 1);
+		// p = low + x^half * high  ->  p(x+a) = low(x+a) + (x+a)^half * high(x+a)
+		std::vector<Coeff> low = shiftRange(offset, half, level - 1);
+		std::vector<Coeff> res = multiplyCoefficients(shiftRange(offset + half, count - half, level - 1), powers[level - 1]);
+		assert(res.size() == count);
+		for (std::size_t i = 0; i < low.size(); i++) {
+			res[i] += low[i];
+		}
+		return res;
+	};
+	mCoefficients = shiftRange(0, size, powers.size());
+}
+
+template<typename Coeff>
+template<typename C, EnableIf<any<is_subset_of_rationals<C>, is_subset_of_integers<C>>>>
+void UnivariatePolynomial<Coeff>::shiftConvolution(const Coeff& a) {
+	std::size_t size = mCoefficients.size();
+	// factorials[i] = i!
+	std::vector<Coeff> factorials(size, constant_one<Coeff>::get());
+	Coeff index = constant_one<Coeff>::get();
+	for (std::size_t i = 1; i < size; i++) {
+		factorials[i] = factorials[i-1] * index;
+		index += constant_one<Coeff>::get();
+	}
+	// lhs[n-i] = i! * p_i and rhs[j] = a^j * n! / j!
+	std::vector<Coeff> lhs(size, Coeff(0));
+	std::vector<Coeff> rhs(size, Coeff(0));
+	Coeff power = constant_one<Coeff>::get();
+	for (std::size_t i = 0; i < size; i++) {
+		lhs[size-1-i] = mCoefficients[i] * factorials[i];
+		rhs[i] = power * carl::div(factorials.back(), factorials[i]);
+		power *= a;
+	}
+	// conv[n-k] = n! * k! * q_k where q is the shifted polynomial.
+	std::vector<Coeff> conv = multiplyCoefficients(lhs, rhs);
+	for (std::size_t k = 0; k < size; k++) {
+		mCoefficients[k] = carl::div(conv[size-1-k], Coeff(factorials.back() * factorials[k]));
+	}
+}
+
+template<typename Coeff>
+template<typename C, DisableIf<is_subset_of_rationals<C>, is_subset_of_integers<C>>>
+void UnivariatePolynomial<Coeff>::shiftConvolution(const Coeff& a) {
+	CARL_LOG_WARN("carl.core", "Taylor shift by convolution needs exact numbers, falling back to divide-and-conquer.");
+	shiftDivideAndConquer(a);
+}
+
+template<typename Coeff>
+void UnivariatePolynomial<Coeff>::multiplyCoefficients(const Coeff* lhs, std::size_t lsize, const Coeff* rhs, std::size_t rsize, Coeff* res) {
+	// Below this size, the schoolbook method is faster than Karatsuba.
+	// Intervals are always multiplied with the schoolbook method, as the subtractions in Karatsuba widen them unnecessarily.
+	const std::size_t karatsubaThreshold = 24;
+	if (lsize == 0 || rsize == 0) return;
+	if (is_interval<Coeff>::value || lsize < karatsubaThreshold || rsize < karatsubaThreshold) {
+		for (std::size_t i = 0; i < lsize; i++) {
+			for (std::size_t j = 0; j < rsize; j++) {
+				res[i+j] += lhs[i] * rhs[j];
+			}
+		}
+		return;
+	}
+	if (lsize != rsize) {
+		// Multiply blockwise with blocks as large as the smaller factor.
+		if (lsize < rsize) {
+			std::swap(lhs, rhs);
+			std::swap(lsize, rsize);
+		}
+		for (std::size_t offset = 0; offset < lsize; offset += rsize) {
+			multiplyCoefficients(lhs + offset, std::min(rsize, lsize - offset), rhs, rsize, res + offset);
+		}
+		return;
+	}
+	// lhs = l0 + x^m * l1, rhs = r0 + x^m * r1
+	std::size_t m = lsize / 2;
+	std::size_t h = lsize - m;
+	std::vector<Coeff> low(2*m - 1, Coeff(0));
+	std::vector<Coeff> mid(2*h - 1, Coeff(0));
+	std::vector<Coeff> high(2*h - 1, Coeff(0));
+	multiplyCoefficients(lhs, m, rhs, m, low.data());
+	multiplyCoefficients(lhs + m, h, rhs + m, h, high.data());
+	std::vector<Coeff> lsum(lhs + m, lhs + lsize);
+	std::vector<Coeff> rsum(rhs + m, rhs + rsize);
+	for (std::size_t i = 0; i < m; i++) {
+		lsum[i] += lhs[i];
+		rsum[i] += rhs[i];
 	}
-	this->mCoefficients = next;
+	// (l0 + l1) * (r0 + r1) - l0 * r0 - l1 * r1 = l0 * r1 + l1 * r0
+	multiplyCoefficients(lsum.data(), h, rsum.data(), h, mid.data());
+	for (std::size_t i = 0; i < low.size(); i++) {
+		mid[i] -= low[i];
+		res[i] += low[i];
+	}
+	for (std::size_t i = 0; i < high.size(); i++) {
+		mid[i] -= high[i];
+		res[2*m + i] += high[i];
+	}
+	for (std::size_t i = 0; i < mid.size(); i++) {
+		res[m + i] += mid[i];
+	}
+}
+
+template<typename Coeff>
+std::vector<Coeff> UnivariatePolynomial<Coeff>::multiplyCoefficients(const std::vector<Coeff>& lhs, const std::vector<Coeff>& rhs) {
+	if (lhs.empty() || rhs.empty()) return std::vector<Coeff>();
+	std::vector<Coeff> res(lhs.size() + rhs.size() - 1, Coeff(0));
+	multiplyCoefficients(lhs.data(), lhs.size(), rhs.data(), rhs.size(), res.data());
+	return res;
 }
 
 template<typename Coeff>
@@ -2024,19 +2182,7 @@ UnivariatePolynomial<Coeff>& UnivariatePolynomial<Coeff>::operator*=(const Univa
 		return *this;
 	}
 	
-	std::vector<Coeff> newCoeffs; 
-	newCoeffs.reserve(mCoefficients.size() + rhs.mCoefficients.size());
-	for(std::size_t e = 0; e < mCoefficients.size() + rhs.degree(); ++e)
-	{
-		newCoeffs.push_back(Coeff(0));
-		for(std::size_t i = 0; i < mCoefficients.size() && i <= e; ++i)
-		{
-			if(e - i < rhs.mCoefficients.size())
-			{
-				newCoeffs.back() += mCoefficients[i] * rhs.mCoefficients[e-i];
-			}
-		}
-	}
+	std::vector<Coeff> newCoeffs = multiplyCoefficients(mCoefficients, rhs.mCoefficients);
 	mCoefficients.swap(newCoeffs);
 	stripLeadingZeroes();
 	return *this;
@@ -67,12 +67,12 @@ public:
 		mIR(std::make_shared<IntervalContent>(p.normalized(), i)),
 		mTE(nullptr)
 	{
-		assert(!mIR->polynomial.isZero() && mIR->polynomial.degree() > 0);
+		assert(!mIR->polynomial().isZero() && mIR->polynomial().degree() > 0);
 		assert(i.isOpenInterval() || i.isPointInterval());
 		assert(p.countRealRoots(i) == 1);
-		if (mIR->polynomial.degree() == 1) {
-			Number a = mIR->polynomial.coefficients()[1];
-			Number b = mIR->polynomial.coefficients()[0];
+		if (mIR->polynomial().degree() == 1) {
+			Number a = mIR->polynomial().coefficients()[1];
+			Number b = mIR->polynomial().coefficients()[0];
 			switchToNR(-b / a);
 		} else {
 			if (i.contains(0)) refineAvoiding(0);
@@ -92,9 +92,20 @@ public:
 	RealAlgebraicNumber& operator=(const RealAlgebraicNumber& n) = default;
 	RealAlgebraicNumber& operator=(RealAlgebraicNumber&& n) = default;
 	
+	/**
+	 * Creates a copy that does not share its isolating interval with this number.
+	 * Refining either number afterwards does not affect the other one, hence the copy can safely be used by another thread.
+	 * @return Independent copy of this number.
+	 */
+	RealAlgebraicNumber deepCopy() const {
+		RealAlgebraicNumber res(*this);
+		if (mIR) res.mIR = std::make_shared<IntervalContent>(*mIR);
+		return res;
+	}
+	
 	std::size_t size() const {
 		if (isNumeric()) return carl::bitsize(mValue);
-		else if (isInterval()) return carl::bitsize(mIR->interval.lower()) + carl::bitsize(mIR->interval.upper()) * mIR->polynomial.degree();
+		else if (isInterval()) return carl::bitsize(mIR->interval.lower()) + carl::bitsize(mIR->interval.upper()) * mIR->polynomial().degree();
 		else return 0;
 	}
 	
@@ -173,13 +184,13 @@ public:
 	const Polynomial& getIRPolynomial() const {
 		assert(!isNumeric());
 		assert(isInterval());
-		return mIR->polynomial;
+		return mIR->polynomial();
 	}
 	
 	RealAlgebraicNumber changeVariable(Variable::Arg v) const {
 		if (isNumeric()) return *this;
 		assert(isInterval());
-		return RealAlgebraicNumber<Number>(mIR->polynomial.replaceVariable(v), mIR->interval, mIsRoot);
+		return RealAlgebraicNumber<Number>(mIR->polynomial().replaceVariable(v), mIR->interval, mIsRoot);
 	}
 	
 	Sign sgn() const {
@@ -257,7 +268,7 @@ public:
 	
 	RealAlgebraicNumber<Number> abs() const {
 		if (isNumeric()) return RealAlgebraicNumber<Number>(carl::abs(mValue), mIsRoot);
-		if (isInterval()) return RealAlgebraicNumber<Number>(mIR->polynomial, mIR->interval.abs(), mIsRoot);
+		if (isInterval()) return RealAlgebraicNumber<Number>(mIR->polynomial(), mIR->interval.abs(), mIsRoot);
 		return RealAlgebraicNumber<Number>();
 	}
 
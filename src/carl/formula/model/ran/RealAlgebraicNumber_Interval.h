@@ -3,20 +3,99 @@
 #include "../../../core/UnivariatePolynomial.h"
 
 #include "../../../interval/Interval.h"
+#include "../../../util/Singleton.h"
 
+#include <algorithm>
 #include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 
 namespace carl {
 namespace ran {
+	/**
+	 * Defining polynomial of interval represented real algebraic numbers together with its Sturm sequence.
+	 * Objects of this type are interned by the PolynomialPool and shared by all numbers with the same defining polynomial.
+	 */
+	template<typename Number>
+	struct PolynomialContent {
+		using Polynomial = UnivariatePolynomial<Number>;
+
+		Polynomial polynomial;
+		std::list<Polynomial> sturmSequence;
+
+		explicit PolynomialContent(const Polynomial& p):
+			polynomial(p),
+			sturmSequence(p.standardSturmSequence())
+		{}
+	};
+
+	/**
+	 * Pool that interns the defining polynomials of real algebraic numbers.
+	 * Only weak references are stored, hence a polynomial is released as soon as no number refers to it anymore.
+	 */
+	template<typename Number>
+	class PolynomialPool: public Singleton<PolynomialPool<Number>> {
+		friend Singleton<PolynomialPool<Number>>;
+		using Polynomial = UnivariatePolynomial<Number>;
+		using Content = PolynomialContent<Number>;
+	private:
+		std::unordered_map<Polynomial, std::weak_ptr<const Content>> mPool;
+		/// Pool size that triggers the next purge of expired entries.
+		std::size_t mPurgeThreshold = 64;
+		mutable std::mutex mMutex;
+
+		#ifdef THREAD_SAFE
+		#define RAN_POLYNOMIAL_POOL_LOCK_GUARD std::lock_guard<std::mutex> lock(mMutex);
+		#else
+		#define RAN_POLYNOMIAL_POOL_LOCK_GUARD
+		#endif
+
+		void purge() {
+			for (auto it = mPool.begin(); it != mPool.end();) {
+				if (it->second.expired()) it = mPool.erase(it);
+				else ++it;
+			}
+			mPurgeThreshold = std::max(std::size_t(64), 2 * mPool.size());
+		}
+	protected:
+		PolynomialPool() = default;
+	public:
+		/**
+		 * Returns the shared content for the given polynomial, creating it if necessary.
+		 * @param p Defining polynomial, already expressed in the auxiliary variable.
+		 * @return Shared polynomial content.
+		 */
+		std::shared_ptr<const Content> get(const Polynomial& p) {
+			RAN_POLYNOMIAL_POOL_LOCK_GUARD
+			auto it = mPool.find(p);
+			if (it != mPool.end()) {
+				auto res = it->second.lock();
+				if (res) return res;
+				mPool.erase(it);
+			}
+			if (mPool.size() >= mPurgeThreshold) purge();
+			auto res = std::make_shared<const Content>(p);
+			mPool.emplace(p, res);
+			return res;
+		}
+		/**
+		 * @return Number of polynomials currently stored, including expired ones that have not yet been purged.
+		 */
+		std::size_t size() const {
+			RAN_POLYNOMIAL_POOL_LOCK_GUARD
+			return mPool.size();
+		}
+	};
+
 	template<typename Number>
 	struct IntervalContent {
 		using Polynomial = UnivariatePolynomial<Number>;
 		
 		static const Variable auxVariable;
 		
-		Polynomial polynomial;
+		std::shared_ptr<const PolynomialContent<Number>> content;
 		Interval<Number> interval;
-		std::list<Polynomial> sturmSequence;
 		std::size_t refinementCount;
 		
 		Polynomial replaceVariable(const Polynomial& p) const {
@@ -27,30 +106,43 @@ namespace ran {
 			const Polynomial& p,
 			const Interval<Number> i
 		):
-			polynomial(replaceVariable(p)),
+			content(PolynomialPool<Number>::getInstance().get(replaceVariable(p))),
 			interval(i),
-			sturmSequence(p.standardSturmSequence()),
-			refinementCount(0)
-		{}
-		
-		IntervalContent(
-			const Polynomial& p,
-			const Interval<Number> i,
-			const std::list<UnivariatePolynomial<Number>>& seq
-		):
-			polynomial(replaceVariable(p)),
-			interval(i),
-			sturmSequence(seq),
 			refinementCount(0)
 		{}
+
+		const Polynomial& polynomial() const {
+			return content->polynomial;
+		}
+		const std::list<Polynomial>& sturmSequence() const {
+			return content->sturmSequence;
+		}
+		/**
+		 * Replaces the defining polynomial, for example by a factor of the current one.
+		 * @param p New defining polynomial.
+		 */
+		void setPolynomial(const Polynomial& p) {
+			content = PolynomialPool<Number>::getInstance().get(replaceVariable(p));
+		}
+		/**
+		 * Counts the real roots of the defining polynomial within the given interval using the shared Sturm sequence.
+		 * @param i Interval whose bounds are no roots.
+		 * @return Number of real roots within i.
+		 */
+		int countRealRoots(const Interval<Number>& i) const {
+			assert(!polynomial().isRoot(i.lower()));
+			assert(!polynomial().isRoot(i.upper()));
+			return Polynomial::countRealRoots(sturmSequence(), i);
+		}
+
 		bool isIntegral() {
 			return interval.isPointInterval() && carl::isInteger(interval.lower());
 		}
 		
 		Sign sgn(const Polynomial& p) const {
 			Polynomial tmp = replaceVariable(p);
-			if (polynomial == tmp) return Sign::ZERO;
-			auto seq = polynomial.standardSturmSequence(polynomial.derivative() * tmp);
+			if (polynomial() == tmp) return Sign::ZERO;
+			auto seq = polynomial().standardSturmSequence(polynomial().derivative() * tmp);
 			int variations = Polynomial::countRealRoots(seq, interval);
 			assert((variations == -1) || (variations == 0) || (variations == 1));
 			switch (variations) {
@@ -65,10 +157,10 @@ namespace ran {
 		void refine() {
 			Number pivot = interval.sample();
 			assert(interval.contains(pivot));
-			if (polynomial.isRoot(pivot)) {
+			if (polynomial().isRoot(pivot)) {
 				interval = Interval<Number>(pivot, pivot);
 			} else {
-				if (polynomial.countRealRoots(Interval<Number>(interval.lower(), BoundType::STRICT, pivot, BoundType::STRICT)) > 0) {
+				if (countRealRoots(Interval<Number>(interval.lower(), BoundType::STRICT, pivot, BoundType::STRICT)) > 0) {
 					interval.setUpper(pivot);
 				} else {
 					interval.setLower(pivot);
@@ -86,11 +178,11 @@ namespace ran {
 		 */
 		bool refineAvoiding(const Number& n) {
 			if (interval.contains(n)) {
-				if (polynomial.isRoot(n)) {
+				if (polynomial().isRoot(n)) {
 					interval = Interval<Number>(n, n);
 					return true;
 				}
-				if (polynomial.countRealRoots(Interval<Number>(interval.lower(), BoundType::STRICT, n, BoundType::STRICT)) > 0) {
+				if (countRealRoots(Interval<Number>(interval.lower(), BoundType::STRICT, n, BoundType::STRICT)) > 0) {
 					interval.setUpper(n);
 				} else {
 					interval.setLower(n);
@@ -104,7 +196,7 @@ namespace ran {
 			
 			Number newBound = interval.sample();
 			
-			if (polynomial.isRoot(newBound)) {
+			if (polynomial().isRoot(newBound)) {
 				interval = Interval<Number>(newBound, newBound);
 				return false;
 			}
@@ -115,11 +207,11 @@ namespace ran {
 				interval.setUpper(newBound);
 			}
 			
-			while (polynomial.countRealRoots(interval) == 0) {
+			while (countRealRoots(interval) == 0) {
 				if (isLeft) {
 					Number oldBound = interval.lower();
 					newBound = Interval<Number>(n, BoundType::STRICT, oldBound, BoundType::STRICT).sample();
-					if (polynomial.isRoot(newBound)) {
+					if (polynomial().isRoot(newBound)) {
 						interval = Interval<Number>(newBound, newBound);
 						return false;
 					}
@@ -128,7 +220,7 @@ namespace ran {
 				} else {
 					Number oldBound = interval.upper();
 					newBound = Interval<Number>(oldBound, BoundType::STRICT, n, BoundType::STRICT).sample();
-					if (polynomial.isRoot(newBound)) {
+					if (polynomial().isRoot(newBound)) {
 						interval = Interval<Number>(newBound, newBound);
 						return false;
 					}
@@ -82,8 +82,10 @@ public:
 	 * @param r additional dimension given as real algebraic number
 	 * @return real algebraic point with higher dimension
 	 */
-	RealAlgebraicPoint conjoin(const RealAlgebraicNumber<Number>& r) {
-		RealAlgebraicPoint res = RealAlgebraicPoint(*this);
+	RealAlgebraicPoint conjoin(const RealAlgebraicNumber<Number>& r) const {
+		RealAlgebraicPoint res;
+		res.numbers.reserve(this->numbers.size() + 1);
+		res.numbers.insert(res.numbers.end(), this->numbers.begin(), this->numbers.end());
 		res.numbers.push_back(r);
 		return res;
 	}
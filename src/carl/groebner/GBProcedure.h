@@ -22,7 +22,8 @@ class AbstractGBProcedure
 	virtual void addPolynomial(const Polynomial& p) = 0;
 	virtual void reset()= 0;
 	virtual void calculate()= 0;
-	
+	virtual void push() = 0;
+	virtual void pop() = 0;
 	
 	virtual std::list<std::pair<BitVector, BitVector> > reduceInput()= 0;
 	virtual const Ideal<Polynomial>& getIdeal() const = 0;
@@ -38,6 +39,11 @@ class AbstractGBProcedure
  * Therefore, it holds a queue with the polynomials which are added. 
  * Only upon calling the calculate method, these polynoimials are added to the actual groebner basis.
  * 
+ * Furthermore, it supports backtracking: push() opens a new level, and pop() restores the state
+ * before the matching push(), i.e. the input polynomials, the scheduled polynomials, the basis and the critical pairs.
+ * A level only keeps a reference to the basis it started with, and the basis is copied once when it is modified within the level.
+ * Critical pairs which are pending at push() are processed within the level on a copy, and are pending again after pop().
+ * 
  * Moreover, we can 
  * @ingroup gb 
  */
@@ -45,6 +51,25 @@ template<typename Polynomial, template<typename, template<typename> class > clas
 class GBProcedure : private Procedure<Polynomial, AddingPolynomialPolicy>, public AbstractGBProcedure<Polynomial>
 {
 private:
+	using CriticalPairsType = typename Procedure<Polynomial, AddingPolynomialPolicy>::CriticalPairsType;
+
+	/**
+	 * The state before a call to push().
+	 */
+	struct Checkpoint
+	{
+		/// The basis, which is not modified while the checkpoint exists.
+		std::shared_ptr<Ideal<Polynomial>> mGb;
+		/// The critical pairs which were not yet processed.
+		std::shared_ptr<CriticalPairsType> mCritPairs;
+		/// The polynomials which were scheduled for adding.
+		std::list<Polynomial> mInputScheduled;
+		/// The number of input polynomials.
+		size_t mNrOrigGenerators;
+		/// Whether the basis was shared with the enclosing level.
+		bool mGbShared;
+	};
+
 	/// The ideal represented by the current elements of the Groebner basis.
 	std::shared_ptr<Ideal<Polynomial>> mGb;
 	/// The polynomials which are added during the next call for calculate.
@@ -53,6 +78,10 @@ private:
 	std::vector<Polynomial> mOrigGenerators;
 	/// Indices of the input polynomials.
 	std::vector<size_t> mOrigGeneratorsIndices;
+	/// The states before the calls to push(), the innermost level last.
+	std::vector<Checkpoint> mCheckpoints;
+	/// Whether mGb is referenced by the innermost checkpoint and hence must be copied before it is modified.
+	bool mGbShared;
 
 public:
 
@@ -61,7 +90,9 @@ public:
 		mGb(new Ideal<Polynomial>),
 		mInputScheduled(),
 		mOrigGenerators(),
-		mOrigGeneratorsIndices()
+		mOrigGeneratorsIndices(),
+		mCheckpoints(),
+		mGbShared(false)
 	{
 		Procedure<Polynomial, AddingPolynomialPolicy>::setIdeal(mGb);
 	}
@@ -72,7 +103,9 @@ public:
 		mGb(new Ideal<Polynomial>(*old.mGb)),
 		mInputScheduled(old.mInputScheduled),
 		mOrigGenerators(old.mOrigGenerators),
-		mOrigGeneratorsIndices(old.mOrigGeneratorsIndices)
+		mOrigGeneratorsIndices(old.mOrigGeneratorsIndices),
+		mCheckpoints(copyCheckpoints(old.mCheckpoints)),
+		mGbShared(false)
 	{
 		Procedure<Polynomial, AddingPolynomialPolicy>::setIdeal(mGb);
 	}
@@ -86,8 +119,10 @@ public:
 		mInputScheduled = rhs.mInputScheduled;
 		mOrigGenerators = rhs.mOrigGenerators;
 		mOrigGeneratorsIndices = rhs.mOrigGeneratorsIndices;
+		mCheckpoints = copyCheckpoints(rhs.mCheckpoints);
+		mGbShared = false;
 		Procedure<Polynomial, AddingPolynomialPolicy>::setIdeal(mGb);
-        Procedure<Polynomial, AddingPolynomialPolicy>::setCriticalPairs(rhs.pCritPairs);
+		Procedure<Polynomial, AddingPolynomialPolicy>::setCriticalPairs(std::make_shared<CriticalPairsType>(*rhs.pCritPairs));
 		return *this;
 	}
 	
@@ -109,6 +144,15 @@ public:
 		return mOrigGenerators.size();
 	}
 
+	/**
+	 * The number of levels opened by push() and not yet closed by pop().
+	 * @return number of levels.
+	 */
+	size_t nrLevels() const
+	{
+		return mCheckpoints.size();
+	}
+
 	/**
 	 * Add a polynmomial which is added to the groebner basis during the next calculate call.
      * @param p The polynomial to be added.
@@ -119,6 +163,16 @@ public:
 		mOrigGenerators.push_back(p);
 	}
 
+	/**
+	 * Enables the fraction-free reduction within the procedure, if the procedure supports it, see BuchbergerProcedure::setFractionFree().
+	 * The input polynomials and the final basis are still reduced as usual.
+	 * @param fractionFree Whether to reduce fraction-free.
+	 */
+	void setFractionFree(bool fractionFree = true)
+	{
+		Procedure<Polynomial, AddingPolynomialPolicy>::setFractionFree(fractionFree);
+	}
+
 	/**
 	 * Checks whether the current representants of the GB contain a constant polynomial.
      * @return 
@@ -176,6 +230,7 @@ public:
 	void reset() 
 	{
 		mGb.reset(new Ideal<Polynomial>());
+		mGbShared = false;
 		Procedure<Polynomial, AddingPolynomialPolicy>::setIdeal(mGb);
 	}
 	
@@ -198,6 +253,7 @@ public:
 		{
 			return;
 		}
+		copyIdealOnWrite();
 		// Use procedure
 		Procedure<Polynomial, AddingPolynomialPolicy>::calculate(mInputScheduled);
 		// remove the just added polynomials from the set of input polynomials
@@ -256,8 +312,67 @@ public:
 
 		return result;
 	}
+
+	/**
+	 * Open a new backtrack level.
+	 * All polynomials added and all calculations done from now on are undone by the matching pop().
+	 */
+	void push()
+	{
+		CARL_LOG_DEBUG("carl.gb.gbproc", "Push level " << mCheckpoints.size() + 1);
+		const std::shared_ptr<CriticalPairsType>& critPairs = Procedure<Polynomial, AddingPolynomialPolicy>::pCritPairs;
+		mCheckpoints.push_back(Checkpoint{mGb, critPairs, mInputScheduled, mOrigGenerators.size(), mGbShared});
+		mGbShared = true;
+		// The level works on a copy of the pending critical pairs, the checkpoint keeps the original ones for pop().
+		Procedure<Polynomial, AddingPolynomialPolicy>::setCriticalPairs(std::make_shared<CriticalPairsType>(*critPairs));
+	}
+
+	/**
+	 * Close the innermost backtrack level and restore the state before the matching push().
+	 */
+	void pop()
+	{
+		assert(!mCheckpoints.empty());
+		CARL_LOG_DEBUG("carl.gb.gbproc", "Pop level " << mCheckpoints.size());
+		Checkpoint& checkpoint = mCheckpoints.back();
+		mGb = std::move(checkpoint.mGb);
+		mInputScheduled = std::move(checkpoint.mInputScheduled);
+		mOrigGenerators.resize(checkpoint.mNrOrigGenerators);
+		mGbShared = checkpoint.mGbShared;
+		Procedure<Polynomial, AddingPolynomialPolicy>::setIdeal(mGb);
+		Procedure<Polynomial, AddingPolynomialPolicy>::setCriticalPairs(checkpoint.mCritPairs);
+		mCheckpoints.pop_back();
+	}
 private:
 
+	/**
+	 * Copies the basis if a checkpoint refers to it, such that the checkpoint is not modified.
+	 */
+	void copyIdealOnWrite()
+	{
+		if(!mGbShared) return;
+		mGb.reset(new Ideal<Polynomial>(*mGb));
+		mGbShared = false;
+		Procedure<Polynomial, AddingPolynomialPolicy>::setIdeal(mGb);
+	}
+
+	/**
+	 * Copies the checkpoints of another procedure.
+	 * The bases and the critical pairs are copied, such that neither procedure modifies a checkpoint of the other one.
+	 * Levels which share a basis also share its copy.
+	 */
+	static std::vector<Checkpoint> copyCheckpoints(const std::vector<Checkpoint>& checkpoints)
+	{
+		std::vector<Checkpoint> res(checkpoints);
+		for(std::size_t i = 0; i < res.size(); ++i)
+		{
+			if(checkpoints[i].mGbShared) res[i].mGb = res[i - 1].mGb;
+			else res[i].mGb = std::make_shared<Ideal<Polynomial>>(*checkpoints[i].mGb);
+			res[i].mCritPairs = std::make_shared<CriticalPairsType>(*checkpoints[i].mCritPairs);
+		}
+		return res;
+	}
+
 	void reduceGB()
 	{
 		for(size_t i = 0; i < mGb->nrGenerators(); ++i)
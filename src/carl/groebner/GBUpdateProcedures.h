@@ -50,6 +50,9 @@ template<typename Polynomial>
 struct RealRadicalAwareAdding
 {
 private:
+#ifdef BUCHBERGER_STATISTICS
+	BuchbergerStats* mStats = BuchbergerStats::getInstance();
+#endif
 	
 public:
 	virtual ~RealRadicalAwareAdding() 
@@ -83,7 +86,7 @@ public:
 			if(p.hasConstantTerm())
 			{
 #ifdef BUCHBERGER_STATISTICS
-				if(p.nrOfTerms() > 1) mStats->TSQWithConstant();
+				if(p.nrTerms() > 1) mStats->TSQWithConstant();
 #endif
 				gb->clear();
 				Polynomial q(1);
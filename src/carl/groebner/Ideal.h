@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "ideal-ds/IdealDSKDTree.h"
 #include "ideal-ds/IdealDSVector.h"
 #include "ideal-ds/PolynomialSorts.h"
 
@@ -19,7 +20,7 @@ namespace carl
 /**
  * @ingroup gb
  */
-template <class Polynomial, template<class> class Datastructure = IdealDatastructureVector, int CacheSize = 0>
+template <class Polynomial, template<class> class Datastructure = IdealDatastructureKDTree, int CacheSize = 0>
 class Ideal
 {
 private:
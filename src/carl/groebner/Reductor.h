@@ -11,6 +11,10 @@
 #include "ReductorEntry.h"
 #include "../util/Heap.h"
 #include "../util/BitVector.h"
+#include "../util/SFINAE.h"
+
+#include <algorithm>
+#include <vector>
 
 namespace carl
 {
@@ -74,15 +78,25 @@ protected:
 	using Coeff = typename InputPolynomial::CoeffType;
 private:
 	const Ideal<PolynomialInIdeal>& mIdeal;
+	/// The polynomial which is reduced, fully ordered, such that the entries can refer to it.
+	InputPolynomial mInput;
 	Datastructure<Configuration<InputPolynomial>> mDatastruct;
 	std::vector<Term<Coeff>> mRemainder;
 	bool mReductionOccured;
 	BitVector mReasons;
+	/// The sugar of the generators, indexed like the generators of the ideal, or nullptr if the sugar is not tracked.
+	const std::vector<exponent>* mGeneratorSugar = nullptr;
+	exponent mSugar = 0;
+	bool mFractionFree = false;
 public:
 	Reductor(const Ideal<PolynomialInIdeal>& ideal, const InputPolynomial& f) :
-	mIdeal(ideal), mDatastruct(Configuration<InputPolynomial>()), mReductionOccured(false)
+	mIdeal(ideal), mInput(f), mDatastruct(Configuration<InputPolynomial>()), mReductionOccured(false)
 	{
-		insert(f, Term<Coeff>(Coeff(1)));
+		if(!mInput.isZero())
+		{
+			mInput.makeOrdered();
+			mDatastruct.push(new EntryType(Term<Coeff>(Coeff(1)), mInput));
+		}
 		if(InputPolynomial::Policy::has_reasons)
 		{
 			mReasons = f.getReasons();
@@ -91,7 +105,7 @@ public:
 	}
 
 	Reductor(const Ideal<PolynomialInIdeal>& ideal, const Term<Coeff>& f) :
-	mIdeal(ideal), mDatastruct(Configuration<InputPolynomial>())
+	mIdeal(ideal), mInput(), mDatastruct(Configuration<InputPolynomial>()), mReductionOccured(false)
 	{
 		insert(f);
 	}
@@ -150,9 +164,22 @@ public:
 				{
 					mReasons.calculateUnion(divres.mDivisor->getReasons());
 				}
+				if(mGeneratorSugar != nullptr)
+				{
+					updateSugar(divres);
+				}
+				Term<Coeff> factor = divres.mFactor;
+				if(mFractionFree && divres.mDivisor->lcoeff() != Coeff(1))
+				{
+					// Instead of subtracting c/d * t * g, we compute d * p - c * t * g.
+					scale(divres.mDivisor->lcoeff());
+					factor = Term<Coeff>(-leadingTerm.coeff(), divres.mFactor.monomial());
+				}
 				if(divres.mDivisor->nrTerms() > 1)
 				{
-					insert(divres.mDivisor->tail(true), divres.mFactor);
+					// The entry refers to the divisor, which therefore has to be fully ordered.
+					divres.mDivisor->makeOrdered();
+					mDatastruct.push(new EntryType(factor, *divres.mDivisor, divres.mDivisor->nrTerms() - 1));
 				}
 			}
 			else
@@ -165,6 +192,38 @@ public:
 		return true;
 	}
 
+	/**
+	 * Enables the computation of the sugar of the remainder.
+	 * Every reduction step p - t*g raises the sugar to at least deg(t) + sugar(g).
+	 * @param sugar The sugar of the polynomial which is reduced.
+	 * @param generatorSugar The sugar of the generators, indexed like the generators of the ideal.
+	 *  Generators without an entry have their total degree as sugar.
+	 */
+	void trackSugar(exponent sugar, const std::vector<exponent>* generatorSugar)
+	{
+		mSugar = sugar;
+		mGeneratorSugar = generatorSugar;
+	}
+
+	/**
+	 * Gets the sugar of the remainder, if trackSugar was called before the reduction.
+	 * @return The sugar.
+	 */
+	exponent sugar() const
+	{
+		return mSugar;
+	}
+
+	/**
+	 * Enables the fraction-free reduction.
+	 * Instead of dividing by the leading coefficient of the reducer, the polynomial is multiplied by it.
+	 * The content of the remainder is only removed at the end, hence fullReduce() returns the remainder up to a constant factor.
+	 */
+	void setFractionFree(bool fractionFree = true)
+	{
+		mFractionFree = fractionFree;
+	}
+
 	/**
 	 * Gets the flag which indicates that a reduction has occurred  (p -> p' with p' != p)
 	 * @return the value of the flag
@@ -190,6 +249,10 @@ public:
 		}
 		// TODO check whether this is sorted.
 		InputPolynomial result(std::move(mRemainder), true, false);
+		if(mFractionFree && !result.isZero())
+		{
+			result = removeContent(result);
+		}
 		if(InputPolynomial::Policy::has_reasons)
 		{
 			result.setReasons(mReasons);
@@ -214,7 +277,7 @@ private:
 	inline bool updateDatastruct(EntryType* entry)
 	{
 		assert(!mDatastruct.empty());
-		if(entry->getTail().isZero())
+		if(!entry->hasTail())
 		{
 			mDatastruct.pop();
 			delete entry;
@@ -229,12 +292,44 @@ private:
 		return true;
 	}
 
-	void insert(const InputPolynomial& g, const Term<Coeff>& fact)
+	void updateSugar(const DivisionLookupResult<PolynomialInIdeal>& divres)
+	{
+		const PolynomialInIdeal& divisor = *divres.mDivisor;
+		exponent sugar = divisor.isConstant() ? 0 : divisor.lmon()->tdeg();
+		std::size_t index = std::size_t(divres.mDivisor - mIdeal.getGenerators().data());
+		if(index < mGeneratorSugar->size())
+		{
+			sugar = std::max(sugar, (*mGeneratorSugar)[index]);
+		}
+		mSugar = std::max(mSugar, exponent(divres.mFactor.tdeg()) + sugar);
+	}
+
+	/**
+	 * Divides the polynomial by its content, for coefficients which are not rationals by its leading coefficient.
+	 */
+	template<typename C = Coeff, EnableIf<is_subset_of_rationals<C>> = dummy>
+	static InputPolynomial removeContent(const InputPolynomial& p)
+	{
+		return p.coprimeCoefficients();
+	}
+	template<typename C = Coeff, DisableIf<is_subset_of_rationals<C>> = dummy>
+	static InputPolynomial removeContent(const InputPolynomial& p)
+	{
+		return p.normalize();
+	}
+
+	/**
+	 * Multiplies the polynomial which is reduced by a constant, that is, all entries and the remainder.
+	 */
+	void scale(const Coeff& factor)
 	{
-		if(!g.isZero())
+		for(auto it = mDatastruct.begin(); it != mDatastruct.end(); it.next())
+		{
+			it.get()->scale(factor);
+		}
+		for(Term<Coeff>& t : mRemainder)
 		{
-			CARL_LOG_TRACE("carl.gb.reductor", "Insert polynomial: " << g << " * " << fact);
-			mDatastruct.push(new EntryType(fact, g));
+			t = Term<Coeff>(t.coeff() * factor, t.monomial());
 		}
 	}
 
@@ -9,7 +9,7 @@
 #include "../core/Term.h"
 
 #include <cassert>
-#include <memory>
+#include <cstddef>
 
 namespace carl
 {
@@ -17,7 +17,10 @@ namespace carl
 /**
  * An entry in the reduction polynomial.
  * The class decodes a polynomial given by
- * mLead + mMultiple * mTail.
+ * mLead + mMultiple * (the remaining terms of mPolynomial).
+ *
+ * The entry does not copy the polynomial, but only refers to it and keeps the position of the next term.
+ * Hence, the polynomial has to be fully ordered and must outlive the entry.
  * @ingroup gb
  */
 template <class Polynomial>
@@ -25,21 +28,32 @@ class ReductorEntry
 {
 protected:
     using Coeff = typename Polynomial::CoeffType ;
-    Polynomial mTail;
+    /// The polynomial, or nullptr if the entry consists of a single term.
+    const Polynomial* mPolynomial;
+    /// The number of terms of mPolynomial which are not yet consumed. The terms are consumed from the largest on.
+    std::size_t mPosition;
     Term<Coeff> mLead;
     Term<Coeff> mMultiple;
 
 public:
     /**
-     * Constructor with a factor and a polynomial
+     * Constructor with a factor and a fully ordered polynomial.
      * @param multiple
      * @param pol
-     * Resulting polynomial = multiple * pol.
+     * @param nrTerms The number of (smallest) terms of pol which are used, by default all of them.
+     * Resulting polynomial = multiple * (the nrTerms smallest terms of pol).
      */
-    ReductorEntry(const Term<Coeff>&  multiple, const Polynomial& pol) :
-    mTail(pol.tail()), mLead(multiple * pol.lterm()), mMultiple(multiple)
+    ReductorEntry(const Term<Coeff>&  multiple, const Polynomial& pol, std::size_t nrTerms) :
+    mPolynomial(&pol), mPosition(nrTerms - 1), mLead(multiple * *(pol.begin() + long(mPosition))), mMultiple(multiple)
     {
 		assert(!multiple.isZero());
+		assert(pol.isOrdered());
+		assert(nrTerms > 0 && nrTerms <= pol.nrTerms());
+    }
+
+    ReductorEntry(const Term<Coeff>&  multiple, const Polynomial& pol) :
+    ReductorEntry(multiple, pol, pol.nrTerms())
+    {
     }
 
     /**
@@ -47,16 +61,16 @@ public:
      * @param pol
      */
     explicit ReductorEntry(const Term<Coeff>& pol)
-    : mTail(), mLead(pol), mMultiple(Term<Coeff>(Coeff(1)))
+    : mPolynomial(nullptr), mPosition(0), mLead(pol), mMultiple(Term<Coeff>(Coeff(1)))
     {
     }
 
     /**
-     * @return The tail of the polynomial, not multiplied by the correct factor!
+     * @return true iff there are terms besides the leading term.
      */
-    const Polynomial& getTail() const
+    bool hasTail() const
     {
-        return mTail;
+        return mPosition != 0;
     }
 
     /**
@@ -82,10 +96,21 @@ public:
      */
     void removeLeadingTerm()
     {
-        assert(mTail.nrTerms() != 0);
+        assert(hasTail());
 		assert(!mMultiple.isZero());
-		mLead = mMultiple * mTail.lterm();
-        mTail.stripLT();
+		--mPosition;
+		mLead = mMultiple * *(mPolynomial->begin() + long(mPosition));
+    }
+
+    /**
+     * Multiplies the polynomial by a constant.
+     * @param factor
+     */
+    void scale(const Coeff& factor)
+    {
+        assert(factor != Coeff(0));
+        mLead = Term<Coeff>(mLead.coeff() * factor, mLead.monomial());
+        mMultiple = Term<Coeff>(mMultiple.coeff() * factor, mMultiple.monomial());
     }
 
     /**
@@ -96,14 +121,14 @@ public:
     bool addCoefficient(const Coeff& coeffToBeAdded)
     {
         assert(!empty());
-		Coeff newCoeff = mLead->coeff() + coeffToBeAdded;
+		Coeff newCoeff = mLead.coeff() + coeffToBeAdded;
 		
         if(newCoeff != 0)
         {
-			mLead = Term<Coeff>(newCoeff, mLead->monomial());
+			mLead = Term<Coeff>(newCoeff, mLead.monomial());
             return false;
         }
-        else if(mTail.nrTerms() != 0)
+        else if(hasTail())
         {
             removeLeadingTerm();
         }
@@ -120,7 +145,7 @@ public:
      */
     bool empty() const
     {
-		assert(!mLead.isZero() || mTail.isZero());
+		assert(!mLead.isZero() || !hasTail());
         return mLead.isZero();
     }
 
@@ -128,22 +153,22 @@ public:
      * Output the current polynomial
      * @param os
      */
-    void print(std::ostream& os = std::cout)
+    void print(std::ostream& os = std::cout) const
     {
-		assert(mMultiple);
         if(empty())
 		{
 			os << " ";
+			return;
 		}
-		else
+		os << mLead;
+		for(std::size_t i = mPosition; i > 0; --i)
 		{
-			os << mLead << " +(" << mMultiple << " * " << mTail << ")";
+			os << " + " << mMultiple * *(mPolynomial->begin() + long(i - 1));
 		}
     }
 
     template<class C>
     friend std::ostream& operator <<(std::ostream& os, const ReductorEntry<C> rhs);
-
 };
 
 template<class C>
@@ -31,11 +31,13 @@
 //#define BUCHBERGER_STATISTICS
 
 
+#include "BuchbergerStats.h"
 #include "../GBUpdateProcedures.h"
 #include "../Ideal.h"
 #include "../Reductor.h"
 #include "CriticalPairs.h"
 
+#include <algorithm>
 #include <list>
 #include <unordered_map>
 
@@ -76,39 +78,56 @@ struct DefaultBuchbergerSettings
 /**
  * Gebauer and Moeller style implementation of the Buchberger algorithm. For more information about this Algorithm.
  * More information can be found in the Bachelor Thesis On Groebner Bases in SMT-Compliant Decision Procedures. 
+ *
+ * The order in which the critical pairs are processed is given by the PairSelection strategy, see PairSelection.h.
+ * The sugar of every generator is tracked through the reductions, such that the SugarStrategy can be used.
  * @ingroup gb
  */
-template<typename Polynomial, template<typename> class AddingPolicy>
-class Buchberger : private AddingPolicy<Polynomial>
+template<typename Polynomial, template<typename> class AddingPolicy, typename PairSelection>
+class BuchbergerProcedure : private AddingPolicy<Polynomial>
 {
+public:
+	using CriticalPairsType = CriticalPairsWith<PairSelection>;
 
 protected:
 	std::shared_ptr<Ideal<Polynomial>> pGb;
 	std::vector<size_t> mGbElementsIndices;
-    std::shared_ptr<CritPairs> pCritPairs;
-	UpdateFnct<Buchberger<Polynomial, AddingPolicy>> mUpdateCallBack;
+    std::shared_ptr<CriticalPairsType> pCritPairs;
+	UpdateFnct<BuchbergerProcedure> mUpdateCallBack;
+	/// The sugar of the generators, by their index. Generators without an entry have their total degree as sugar.
+	std::vector<exponent> mSugar;
+	/// The sugar of the polynomial which is currently added.
+	exponent mNextSugar;
+	/// Whether the S-polynomials are reduced fraction-free.
+	bool mFractionFree;
 #ifdef BUCHBERGER_STATISTICS
-	BuchbergerStats* mStats;
+	BuchbergerStats* mStats = BuchbergerStats::getInstance();
 #endif
 
 
 public:
-	Buchberger():
+	BuchbergerProcedure():
 		pGb(),
 		mGbElementsIndices(),
-	    pCritPairs(new CritPairs()),
-		mUpdateCallBack(this)
+	    pCritPairs(new CriticalPairsType()),
+		mUpdateCallBack(this),
+		mSugar(),
+		mNextSugar(0),
+		mFractionFree(false)
 	{
 		
 	}
 	
-	virtual ~Buchberger() = default;
+	virtual ~BuchbergerProcedure() = default;
 	
-	Buchberger(const Buchberger& rhs):
+	BuchbergerProcedure(const BuchbergerProcedure& rhs):
 		pGb(new Ideal<Polynomial>(*rhs.pGb)),
 		mGbElementsIndices(rhs.mGbElementsIndices),
-		pCritPairs(new CritPairs(*rhs.pCritPairs)),
-		mUpdateCallBack(this)
+		pCritPairs(new CriticalPairsType(*rhs.pCritPairs)),
+		mUpdateCallBack(this),
+		mSugar(rhs.mSugar),
+		mNextSugar(rhs.mNextSugar),
+		mFractionFree(rhs.mFractionFree)
 	{
 	}
 	
@@ -117,26 +136,67 @@ public:
 	{
 		pGb = ideal;
 	}
-	void setCriticalPairs(const std::shared_ptr<CritPairs>& criticalPairs)
+	void setCriticalPairs(const std::shared_ptr<CriticalPairsType>& criticalPairs)
 	{
 		pCritPairs = criticalPairs;
 	}
+	/**
+	 * Enables the fraction-free reduction of the S-polynomials, see Reductor::setFractionFree().
+	 * The remainders are normalized before they are added, hence the resulting basis is the same.
+	 */
+	void setFractionFree(bool fractionFree = true)
+	{
+		mFractionFree = fractionFree;
+	}
 
 	//std::list<std::pair<BitVector, BitVector> > reduceInput();
 
 	void update(size_t index);
 protected:
 	
-	bool addToGb(const Polynomial& newPol)
+	bool addToGb(const Polynomial& newPol, exponent sugar = 0)
 	{
 		 CARL_LOG_DEBUG("carl.gb.buchberger", "Add to gb: " << newPol);
+		 mNextSugar = sugar;
 		 return AddingPolicy<Polynomial>::addToGb( newPol, pGb, &mUpdateCallBack);
 	}
+
+	/**
+	 * The sugar of the generator with the given index, which is at least its total degree.
+	 */
+	exponent sugarOf(size_t index) const
+	{
+		const Polynomial& p = pGb->getGenerators()[index];
+		exponent degree = p.isConstant() ? 0 : p.lmon()->tdeg();
+		return index < mSugar.size() ? std::max(mSugar[index], degree) : degree;
+	}
+
 	void removeBuchbergerTriples(std::unordered_map<size_t, SPolPair>& spairs, std::vector<size_t>& primelist);
 
 	void reduce();
 };
 
+/**
+ * Buchberger algorithm with the normal pair selection strategy.
+ * @ingroup gb
+ */
+template<typename Polynomial, template<typename> class AddingPolicy>
+using Buchberger = BuchbergerProcedure<Polynomial, AddingPolicy, NormalStrategy<typename Polynomial::OrderedBy>>;
+
+/**
+ * Buchberger algorithm with the sugar strategy, preferable for inhomogeneous inputs.
+ * @ingroup gb
+ */
+template<typename Polynomial, template<typename> class AddingPolicy>
+using SugarBuchberger = BuchbergerProcedure<Polynomial, AddingPolicy, SugarStrategy<typename Polynomial::OrderedBy>>;
+
+/**
+ * Buchberger algorithm which selects the pairs by the degree of their lcm and then by their age.
+ * @ingroup gb
+ */
+template<typename Polynomial, template<typename> class AddingPolicy>
+using DegreeAgeBuchberger = BuchbergerProcedure<Polynomial, AddingPolicy, DegreeAgeStrategy>;
+
 }
 
 #include "Buchberger.tpp"
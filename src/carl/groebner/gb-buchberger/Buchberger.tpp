@@ -34,8 +34,8 @@ namespace carl
 /**
  * Calculate the Groebner basis
  */
-template<class Polynomial, template<typename> class AddingPolicy>
-void Buchberger<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>& scheduledForAdding)
+template<class Polynomial, template<typename> class AddingPolicy, typename PairSelection>
+void BuchbergerProcedure<Polynomial, AddingPolicy, PairSelection>::calculate(const std::list<Polynomial>& scheduledForAdding)
 {
 	CARL_LOG_INFO("carl.gb.buchberger", "Calculate gb");
 	for(unsigned i = 0; i < pGb->getGenerators().size(); ++i)
@@ -46,7 +46,7 @@ void Buchberger<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>
 	bool foundGB = false;
 	for(const Polynomial& newPol : scheduledForAdding)
 	{
-		if(addToGb(newPol))
+		if(addToGb(newPol, exponent(newPol.totalDegree())))
 		{
 			CARL_LOG_INFO("carl.gb.buchberger", "Added a constant polynomial.");
 			foundGB = true;
@@ -71,11 +71,20 @@ void Buchberger<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>
 			Polynomial spol = Polynomial::SPolynomial(pGb->getGenerators()[critPair.mP1], pGb->getGenerators()[critPair.mP2]);
 			spol.setReasons(pGb->getGenerators()[critPair.mP1].getReasons() | pGb->getGenerators()[critPair.mP2].getReasons());
 			CARL_LOG_DEBUG("carl.gb.buchberger", "SPol: " << spol);
+#ifdef BUCHBERGER_STATISTICS
+			mStats->TreatSPair();
+#endif
 			// Schedules the S-polynomial for reduction
 			Reductor<Polynomial, Polynomial> reductor(*pGb, spol);
+			reductor.trackSugar(critPair.mSugar, &mSugar);
+			reductor.setFractionFree(mFractionFree);
 			// Does a full reduction on this
 			Polynomial remainder = reductor.fullReduce();
 			CARL_LOG_DEBUG("carl.gb.buchberger", "Remainder of SPol: " << remainder);
+#ifdef BUCHBERGER_STATISTICS
+			if(remainder.isZero()) mStats->ZeroReduction();
+			else mStats->NonZeroReduction();
+#endif
 			// If it is not zero, we should add this one to our GB
 			if(!remainder.isZero())
 			{
@@ -91,12 +100,13 @@ void Buchberger<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>
 
 					// divide the polynomial through the leading coefficient.
 
-					if(addToGb(remainder.normalize())) break;
+					if(addToGb(remainder.normalize(), reductor.sugar())) break;
 				}
 			}
 		}
 	}
 	mGbElementsIndices.clear();
+	mSugar.clear();
 }
 
 
@@ -105,13 +115,15 @@ void Buchberger<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>
  * Updating the critical pairs based on the added generator.
  * @param index
  */
-template<class Polynomial, template<typename> class AddingPolicy>
-void Buchberger<Polynomial, AddingPolicy>::update(const size_t index)
+template<class Polynomial, template<typename> class AddingPolicy, typename PairSelection>
+void BuchbergerProcedure<Polynomial, AddingPolicy, PairSelection>::update(const size_t index)
 {
 	
 	std::vector<Polynomial>& generators = pGb->getGenerators();
 	assert(generators.size() > index);
 	assert(!generators[index].isConstant());
+	if(mSugar.size() <= index) mSugar.resize(index + 1, 0);
+	mSugar[index] = std::max(mNextSugar, generators[index].lmon()->tdeg());
 	auto jEnd = mGbElementsIndices.end();
 
 	std::unordered_map<size_t, SPolPair> spairs;
@@ -122,7 +134,10 @@ void Buchberger<Polynomial, AddingPolicy>::update(const size_t index)
 		size_t otherIndex = *jt;
 		assert(generators.size() > otherIndex);
 		uint oideg = generators[otherIndex].lmon() ? generators[otherIndex].lmon()->tdeg() : 0;
-		SPolPair sp(otherIndex, index, Monomial::lcm(generators[index].lmon(), generators[otherIndex].lmon()));
+		Monomial::Arg lcm = Monomial::lcm(generators[index].lmon(), generators[otherIndex].lmon());
+		// The sugar of the S-polynomial is the larger sugar of the two multiples.
+		exponent sugar = std::max(mSugar[index] - generators[index].lmon()->tdeg(), sugarOf(otherIndex) - oideg) + lcm->tdeg();
+		SPolPair sp(otherIndex, index, lcm, sugar);
 		if(sp.mLcm->tdeg() == generators[index].lmon()->tdeg() + oideg)
 		{
 			// *generators[index].lmon( ), *generators[otherIndex].lmon( ) are prime.
@@ -171,8 +186,8 @@ void Buchberger<Polynomial, AddingPolicy>::update(const size_t index)
 	mGbElementsIndices.push_back(index);
 }
 
-template<class Polynomial, template<typename> class AddingPolicy>
-void Buchberger<Polynomial, AddingPolicy>::removeBuchbergerTriples(std::unordered_map<size_t, SPolPair>& spairs, std::vector<size_t>& primelist)
+template<class Polynomial, template<typename> class AddingPolicy, typename PairSelection>
+void BuchbergerProcedure<Polynomial, AddingPolicy, PairSelection>::removeBuchbergerTriples(std::unordered_map<size_t, SPolPair>& spairs, std::vector<size_t>& primelist)
 {
 	auto it = spairs.begin();
 
@@ -83,6 +83,28 @@ public:
         mNrOfNonZeroReductions++;
     }
 
+    /**
+     * Count that an S-Pair reduced to zero
+     */
+    void ZeroReduction( )
+    {
+        mNrOfZeroReductions++;
+    }
+
+    /**
+     * Reset all counters, e.g. before the next benchmark.
+     */
+    void reset( )
+    {
+        mNrOfTSQWithConstant = 0;
+        mNrOfTSQWithoutConstant = 0;
+        mNrOfSingleTermSFP = 0;
+        mNrOfReducibleIdentities = 0;
+        mNrOfReductions = 0;
+        mNrOfNonZeroReductions = 0;
+        mNrOfZeroReductions = 0;
+    }
+
     unsigned getNrTSQWithConstant( ) const
     {
         return mNrOfTSQWithConstant;
@@ -102,6 +124,21 @@ public:
     {
         return mNrOfReducibleIdentities;
     }
+
+    unsigned getNrReductions( ) const
+    {
+        return mNrOfReductions;
+    }
+
+    unsigned getNrNonZeroReductions( ) const
+    {
+        return mNrOfNonZeroReductions;
+    }
+
+    unsigned getNrZeroReductions( ) const
+    {
+        return mNrOfZeroReductions;
+    }
 protected:
 
     BuchbergerStats( ) :
@@ -110,7 +147,8 @@ protected:
     mNrOfSingleTermSFP( 0 ),
     mNrOfReducibleIdentities( 0 ),
     mNrOfReductions( 0 ),
-    mNrOfNonZeroReductions( 0 )
+    mNrOfNonZeroReductions( 0 ),
+    mNrOfZeroReductions( 0 )
     {
     }
     unsigned mNrOfTSQWithConstant;
@@ -119,6 +157,7 @@ protected:
     unsigned mNrOfReducibleIdentities;
     unsigned mNrOfReductions;
     unsigned mNrOfNonZeroReductions;
+    unsigned mNrOfZeroReductions;
 
 private:
     static BuchbergerStats* instance;
@@ -31,22 +31,28 @@
 #include "../../core/MonomialOrdering.h"
 #include "../../util/Heap.h"
 #include "CriticalPairsEntry.h"
+#include "PairSelection.h"
 
+#include <cassert>
 #include <unordered_map>
 
 namespace carl
 {
 
-template< class Compare>
+/**
+ * Configuration of the heap of critical pairs.
+ * @tparam Strategy The pair selection strategy, e.g. NormalStrategy, SugarStrategy or DegreeAgeStrategy.
+ */
+template< class Strategy>
 class CriticalPairConfiguration
 {
 public:
-    using Entry = CriticalPairsEntry<Compare>*;
+    using Entry = CriticalPairsEntry<Strategy>*;
     using CompareResult = carl::CompareResult;
 
     static CompareResult compare( Entry e1, Entry e2 )
     {
-        return Compare::compare( e1->getSortedFirstLCM( ), e2->getSortedFirstLCM( ) );
+        return Strategy::compare( e1->getFirst( ), e2->getFirst( ) );
     }
 
     static bool cmpLessThan( CompareResult res )
@@ -60,7 +66,7 @@ public:
         return res == CompareResult::EQUAL;
     }
 
-    using Order = Compare;
+    using Order = Strategy;
     static const bool fastIndex = true;
 };
 
@@ -78,6 +84,28 @@ public:
 
     }
 
+    /**
+     * Copies the pairs. The entries are cloned, such that popping pairs from the copy does not affect the original.
+     * @param rhs
+     */
+    CriticalPairs( const CriticalPairs& rhs ) : mDatastruct( rhs.mDatastruct.getConfiguration( ) )
+    {
+        for( auto it = rhs.mDatastruct.begin( ); it != rhs.mDatastruct.end( ); it.next( ) )
+        {
+            mDatastruct.push( new CriticalPairsEntry<typename Configuration::Order >( *it.get( ) ) );
+        }
+    }
+
+    CriticalPairs& operator=( const CriticalPairs& ) = delete;
+
+    ~CriticalPairs( )
+    {
+        while( !mDatastruct.empty( ) )
+        {
+            delete mDatastruct.pop( );
+        }
+    }
+
     /**
      * Add a list of s-pairs to the list.
      * @param pairs
@@ -93,6 +121,26 @@ public:
      * @return 
      */
     SPolPair pop( );
+
+	/**
+	 * Gets the lcm of the pair which is returned by the next call to pop, without removing it.
+     * @return 
+     */
+    const Monomial::Arg& topLcm( ) const
+    {
+        assert( !empty( ) );
+        return mDatastruct.top( )->getSortedFirstLCM( );
+    }
+
+	/**
+	 * Gets the sugar of the pair which is returned by the next call to pop, without removing it.
+     * @return 
+     */
+    exponent topSugar( ) const
+    {
+        assert( !empty( ) );
+        return mDatastruct.top( )->getFirst( ).mSugar;
+    }
 	/**
 	 * Eliminate multiples of the given monomial.
      * @param lm
@@ -131,7 +179,13 @@ private:
     Datastructure<Configuration> mDatastruct;
 };
 
-typedef CriticalPairs<Heap, CriticalPairConfiguration<GrLexOrdering> > CritPairs;
+/**
+ * The critical pairs with the given pair selection strategy.
+ */
+template<class Strategy>
+using CriticalPairsWith = CriticalPairs<Heap, CriticalPairConfiguration<Strategy> >;
+
+typedef CriticalPairsWith<NormalStrategy<GrLexOrdering> > CritPairs;
 
 
 }
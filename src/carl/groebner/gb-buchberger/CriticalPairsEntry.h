@@ -37,21 +37,21 @@ namespace carl
 
 /**
  * A list of SPol pairs which have to be checked by the Buchberger algorithm. 
- * We keep the list sorted according the compare ordering on SPol Pairs.
+ * We keep the list sorted according to the pair selection strategy.
  * @ingroup gb
  */
-template<class Compare>
+template<class Strategy>
 class CriticalPairsEntry
 {
 public:
 
 	/**
-	 * Saves the list of pairs and sorts them according the configured ordering.
+	 * Saves the list of pairs and sorts them according the configured strategy.
      * @param pairs
      */
     explicit CriticalPairsEntry(std::list<SPolPair>&& pairs) : mPairs(std::move(pairs))
     {
-        mPairs.sort(SPolPairCompare<Compare>());
+        mPairs.sort(SPolPairCompare<Strategy>());
     }
 
 	/**
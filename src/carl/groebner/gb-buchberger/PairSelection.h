@@ -0,0 +1,65 @@
+/**
+ * @file PairSelection.h
+ * @ingroup gb
+ */
+#pragma once
+
+#include "../../core/CompareResult.h"
+#include "SPolPair.h"
+
+namespace carl
+{
+
+/**
+ * The normal strategy: the pair with the smallest lcm with respect to the given ordering is selected first.
+ * For degree compatible orderings, this is the strategy of Buchberger.
+ * @ingroup gb
+ */
+template<typename Order>
+struct NormalStrategy
+{
+	static CompareResult compare(const SPolPair& p1, const SPolPair& p2)
+	{
+		return Order::compare(p1.mLcm, p2.mLcm);
+	}
+};
+
+/**
+ * The sugar strategy of Giovini et al.: the pair with the smallest sugar is selected first,
+ * ties are broken by the normal strategy.
+ * The sugar is the degree the S-polynomial would have if the input was homogenized,
+ * hence inhomogeneous inputs are processed in the same order as their homogenizations.
+ * @ingroup gb
+ */
+template<typename Order>
+struct SugarStrategy
+{
+	static CompareResult compare(const SPolPair& p1, const SPolPair& p2)
+	{
+		if(p1.mSugar < p2.mSugar) return CompareResult::LESS;
+		if(p1.mSugar > p2.mSugar) return CompareResult::GREATER;
+		return Order::compare(p1.mLcm, p2.mLcm);
+	}
+};
+
+/**
+ * The pair whose lcm has the smallest total degree is selected first,
+ * ties are broken by selecting the oldest pair first.
+ * @ingroup gb
+ */
+struct DegreeAgeStrategy
+{
+	static CompareResult compare(const SPolPair& p1, const SPolPair& p2)
+	{
+		exponent d1 = p1.mLcm->tdeg();
+		exponent d2 = p2.mLcm->tdeg();
+		if(d1 < d2) return CompareResult::LESS;
+		if(d1 > d2) return CompareResult::GREATER;
+		// The second polynomial of a pair is the one which was added later.
+		if(p1.mP2 != p2.mP2) return p1.mP2 < p2.mP2 ? CompareResult::LESS : CompareResult::GREATER;
+		if(p1.mP1 != p2.mP1) return p1.mP1 < p2.mP1 ? CompareResult::LESS : CompareResult::GREATER;
+		return CompareResult::EQUAL;
+	}
+};
+
+}
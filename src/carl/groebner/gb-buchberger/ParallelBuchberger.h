@@ -0,0 +1,93 @@
+/**
+ * @file   ParallelBuchberger.h
+ * @ingroup gb
+ *
+ */
+
+#pragma once
+
+#include "../../config.h"
+#include "Buchberger.h"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace carl
+{
+
+/**
+ * Standard settings for the parallel Buchberger algorithm.
+ * @ingroup gb
+ */
+struct DefaultParallelBuchbergerSettings
+{
+	/// The maximal number of critical pairs which are reduced in one batch.
+	static const std::size_t maxBatchSize = 64;
+	/// The maximal number of threads, zero to use the number of hardware threads.
+	static const unsigned maxThreads = 0;
+};
+
+/**
+ * Buchberger algorithm which reduces batches of S-polynomials concurrently.
+ *
+ * The critical pairs are ordered by the sugar strategy, and all pairs with the lowest sugar are selected at once
+ * (up to Settings::maxBatchSize). Their S-polynomials are reduced concurrently, every thread against its own copy of the current ideal.
+ * Afterwards, the non-zero remainders are reduced again against the ideal and added one after another,
+ * such that the remainders added first reduce the later ones. Hence, the update of the critical pairs, the sugar
+ * and the reason sets are maintained exactly as in SugarBuchberger.
+ *
+ * Monomials are only created concurrently if carl is built with THREAD_SAFE, as the MonomialPool is not synchronized otherwise.
+ * Without THREAD_SAFE, the batches are reduced sequentially.
+ * @ingroup gb
+ */
+template<typename Polynomial, template<typename> class AddingPolicy, typename Settings>
+class ParallelBuchbergerProcedure : public SugarBuchberger<Polynomial, AddingPolicy>
+{
+	using Super = SugarBuchberger<Polynomial, AddingPolicy>;
+
+	/**
+	 * An S-polynomial of a batch together with its sugar.
+	 */
+	struct BatchEntry
+	{
+		Polynomial mPolynomial;
+		exponent mSugar;
+	};
+
+public:
+	ParallelBuchbergerProcedure() = default;
+	ParallelBuchbergerProcedure(const ParallelBuchbergerProcedure& rhs) = default;
+	~ParallelBuchbergerProcedure() override = default;
+
+	void calculate(const std::list<Polynomial>& scheduledForAdding);
+
+protected:
+	/**
+	 * Selects the critical pairs with the lowest sugar and removes them from the critical pairs.
+	 * @return The S-polynomials of the selected pairs, together with their reason sets and their sugar.
+	 */
+	std::vector<BatchEntry> selectBatch();
+
+	/**
+	 * Fully reduces the given polynomials against the current ideal, using several threads.
+	 * @param batch The polynomials, replaced by their remainders, and their sugar, replaced by the sugar of the remainders.
+	 */
+	void reduceBatch(std::vector<BatchEntry>& batch) const;
+
+	/**
+	 * The number of threads used for a batch of the given size.
+	 */
+	static unsigned nrThreads(std::size_t batchSize);
+};
+
+/**
+ * Parallel Buchberger algorithm with the default settings.
+ * @ingroup gb
+ */
+template<typename Polynomial, template<typename> class AddingPolicy>
+using ParallelBuchberger = ParallelBuchbergerProcedure<Polynomial, AddingPolicy, DefaultParallelBuchbergerSettings>;
+
+}
+
+#include "ParallelBuchberger.tpp"
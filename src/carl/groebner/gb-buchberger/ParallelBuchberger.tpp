@@ -0,0 +1,146 @@
+/**
+ * @file ParallelBuchberger.tpp
+ * @ingroup gb
+ */
+#pragma once
+#include "ParallelBuchberger.h"
+
+namespace carl
+{
+
+/**
+ * Calculate the Groebner basis
+ */
+template<class Polynomial, template<typename> class AddingPolicy, typename Settings>
+void ParallelBuchbergerProcedure<Polynomial, AddingPolicy, Settings>::calculate(const std::list<Polynomial>& scheduledForAdding)
+{
+	CARL_LOG_INFO("carl.gb.parallel", "Calculate gb");
+	for(std::size_t i = 0; i < this->pGb->getGenerators().size(); ++i)
+	{
+		this->mGbElementsIndices.push_back(i);
+	}
+
+	bool foundGB = false;
+	for(const Polynomial& newPol : scheduledForAdding)
+	{
+		if(this->addToGb(newPol))
+		{
+			CARL_LOG_INFO("carl.gb.parallel", "Added a constant polynomial.");
+			foundGB = true;
+			break;
+		}
+	}
+
+	while(!foundGB && !this->pCritPairs->empty())
+	{
+		std::vector<BatchEntry> batch = selectBatch();
+		CARL_LOG_DEBUG("carl.gb.parallel", "Reduce a batch of " << batch.size() << " S-polynomials with sugar " << batch.front().mSugar);
+		reduceBatch(batch);
+#ifdef BUCHBERGER_STATISTICS
+		for(const BatchEntry& entry : batch)
+		{
+			this->mStats->TreatSPair();
+			if(entry.mPolynomial.isZero()) this->mStats->ZeroReduction();
+		}
+#endif
+		batch.erase(std::remove_if(batch.begin(), batch.end(), [](const BatchEntry& entry){ return entry.mPolynomial.isZero(); }), batch.end());
+		std::sort(batch.begin(), batch.end(), [](const BatchEntry& lhs, const BatchEntry& rhs){ return Polynomial::compareByLeadingTerm(lhs.mPolynomial, rhs.mPolynomial); });
+
+		// Inter-reduce the remainders by adding them one after another.
+		for(const BatchEntry& entry : batch)
+		{
+			Reductor<Polynomial, Polynomial> reductor(*this->pGb, entry.mPolynomial);
+			reductor.trackSugar(entry.mSugar, &this->mSugar);
+			reductor.setFractionFree(this->mFractionFree);
+			Polynomial remainder = reductor.fullReduce();
+#ifdef BUCHBERGER_STATISTICS
+			if(remainder.isZero()) this->mStats->ZeroReduction();
+			else this->mStats->NonZeroReduction();
+#endif
+			if(remainder.isZero()) continue;
+			if(remainder.isConstant())
+			{
+				this->pGb->clear();
+				this->pGb->addGenerator(remainder.normalize());
+				foundGB = true;
+				break;
+			}
+			if(this->addToGb(remainder.normalize(), reductor.sugar()))
+			{
+				foundGB = true;
+				break;
+			}
+		}
+	}
+	this->mGbElementsIndices.clear();
+	this->mSugar.clear();
+}
+
+template<class Polynomial, template<typename> class AddingPolicy, typename Settings>
+std::vector<typename ParallelBuchbergerProcedure<Polynomial, AddingPolicy, Settings>::BatchEntry> ParallelBuchbergerProcedure<Polynomial, AddingPolicy, Settings>::selectBatch()
+{
+	const std::vector<Polynomial>& generators = this->pGb->getGenerators();
+	std::vector<BatchEntry> batch;
+	exponent sugar = this->pCritPairs->topSugar();
+	while(!this->pCritPairs->empty() && this->pCritPairs->topSugar() == sugar && batch.size() < Settings::maxBatchSize)
+	{
+		SPolPair critPair = this->pCritPairs->pop();
+		assert(critPair.mP1 < generators.size());
+		assert(critPair.mP2 < generators.size());
+		Polynomial spol = Polynomial::SPolynomial(generators[critPair.mP1], generators[critPair.mP2]);
+		spol.setReasons(generators[critPair.mP1].getReasons() | generators[critPair.mP2].getReasons());
+		batch.push_back(BatchEntry{std::move(spol), critPair.mSugar});
+	}
+	return batch;
+}
+
+template<class Polynomial, template<typename> class AddingPolicy, typename Settings>
+void ParallelBuchbergerProcedure<Polynomial, AddingPolicy, Settings>::reduceBatch(std::vector<BatchEntry>& batch) const
+{
+	unsigned threads = nrThreads(batch.size());
+	// Every thread works on its own snapshot, as divisor lookups modify the datastructure of the ideal.
+	// The sugar of the generators is only read during the reduction.
+	auto worker = [this, &batch, threads](unsigned offset)
+	{
+		Ideal<Polynomial> snapshot(*this->pGb);
+		for(std::size_t i = offset; i < batch.size(); i += threads)
+		{
+			Reductor<Polynomial, Polynomial> reductor(snapshot, batch[i].mPolynomial);
+			reductor.trackSugar(batch[i].mSugar, &this->mSugar);
+			reductor.setFractionFree(this->mFractionFree);
+			batch[i].mPolynomial = reductor.fullReduce();
+			batch[i].mSugar = reductor.sugar();
+		}
+	};
+	if(threads == 1)
+	{
+		worker(0);
+		return;
+	}
+	std::vector<std::thread> workers;
+	workers.reserve(threads - 1);
+	for(unsigned t = 1; t < threads; ++t)
+	{
+		workers.emplace_back(worker, t);
+	}
+	worker(0);
+	for(std::thread& w : workers)
+	{
+		w.join();
+	}
+}
+
+template<class Polynomial, template<typename> class AddingPolicy, typename Settings>
+unsigned ParallelBuchbergerProcedure<Polynomial, AddingPolicy, Settings>::nrThreads(std::size_t batchSize)
+{
+#ifdef THREAD_SAFE
+	unsigned threads = Settings::maxThreads;
+	if(threads == 0) threads = std::max(std::thread::hardware_concurrency(), 1u);
+	return unsigned(std::min(std::size_t(threads), std::max(batchSize, std::size_t(1))));
+#else
+	(void)batchSize;
+	return 1;
+#endif
+}
+
+}
@@ -0,0 +1,104 @@
+/**
+ * @file   F4.h
+ * @ingroup gb
+ *
+ */
+
+#pragma once
+
+#include "../gb-buchberger/Buchberger.h"
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace carl
+{
+
+/**
+ * Faugere's F4 algorithm.
+ *
+ * Instead of reducing the S-polynomials one after another, all critical pairs of the lowest degree are selected at once.
+ * Symbolic preprocessing collects the multiples of the basis polynomials which are needed to reduce these S-polynomials,
+ * and all of them are reduced simultaneously by computing a row echelon form of the resulting sparse Macaulay matrix.
+ * The rows whose leading monomials did not occur as leading monomials before are the new elements of the basis.
+ *
+ * The management of the critical pairs, that is the update procedure and the criteria, is shared with Buchberger.
+ * The elimination is exact over the coefficient type of the polynomial, hence works for Q as well as for GFNumber.
+ * @ingroup gb
+ */
+template<typename Polynomial, template<typename> class AddingPolicy>
+class F4 : public Buchberger<Polynomial, AddingPolicy>
+{
+	using Super = Buchberger<Polynomial, AddingPolicy>;
+	using Coeff = typename Polynomial::CoeffType;
+
+	/**
+	 * Orders monomials according to the ordering of the polynomials.
+	 */
+	struct MonomialLess
+	{
+		bool operator()(const Monomial::Arg& lhs, const Monomial::Arg& rhs) const
+		{
+			return Polynomial::OrderedBy::less(lhs, rhs);
+		}
+	};
+	using MonomialSet = std::set<Monomial::Arg, MonomialLess>;
+
+	/**
+	 * A row of the Macaulay matrix.
+	 * The entries are sorted by their columns, where the first column corresponds to the largest monomial.
+	 */
+	struct Row
+	{
+		std::vector<std::pair<std::size_t, Coeff>> mEntries;
+		BitVector mReasons;
+	};
+
+	/**
+	 * A row before the symbolic preprocessing is finished, given by the index of a generator and a monomial factor.
+	 */
+	using RowSpec = std::pair<std::size_t, Monomial::Arg>;
+
+public:
+	F4() = default;
+	F4(const F4& rhs) = default;
+	~F4() override = default;
+
+	void calculate(const std::list<Polynomial>& scheduledForAdding);
+
+protected:
+	/**
+	 * Selects all critical pairs whose lcm has the lowest total degree and removes them from the critical pairs.
+	 * @return The rows corresponding to both polynomials of all selected pairs.
+	 */
+	std::vector<RowSpec> selectPairs();
+
+	/**
+	 * Adds the multiples of the basis polynomials which are needed to reduce the given rows.
+	 * @param rows The rows of the selected pairs.
+	 * @param monomials Receives all monomials which occur in the rows.
+	 * @return The rows of the reducers, followed by the given rows.
+	 */
+	std::vector<RowSpec> symbolicPreprocessing(const std::vector<RowSpec>& rows, MonomialSet& monomials) const;
+
+	/**
+	 * Computes a row echelon form of the given matrix.
+	 * The reduced rows whose leading columns are not among the leading columns of the input are returned.
+	 * @param rows Matrix.
+	 * @param zeroRows Receives the number of rows which were reduced to zero.
+	 * @return The new rows, normalized to leading coefficient one.
+	 */
+	std::vector<Row> reduceMatrix(std::vector<Row>& rows, std::size_t& zeroRows) const;
+
+	/**
+	 * Computes lhs - factor * rhs.
+	 */
+	static void subtractMultiple(Row& lhs, const Coeff& factor, const Row& rhs);
+};
+
+}
+
+#include "F4.tpp"
@@ -0,0 +1,263 @@
+/**
+ * @file F4.tpp
+ * @ingroup gb
+ */
+#pragma once
+#include "F4.h"
+
+namespace carl
+{
+
+/**
+ * Calculate the Groebner basis
+ */
+template<class Polynomial, template<typename> class AddingPolicy>
+void F4<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>& scheduledForAdding)
+{
+	CARL_LOG_INFO("carl.gb.f4", "Calculate gb");
+	for(std::size_t i = 0; i < this->pGb->getGenerators().size(); ++i)
+	{
+		this->mGbElementsIndices.push_back(i);
+	}
+
+	bool foundGB = false;
+	for(const Polynomial& newPol : scheduledForAdding)
+	{
+		if(this->addToGb(newPol))
+		{
+			CARL_LOG_INFO("carl.gb.f4", "Added a constant polynomial.");
+			foundGB = true;
+			break;
+		}
+	}
+
+	while(!foundGB && !this->pCritPairs->empty())
+	{
+		std::vector<RowSpec> selected = selectPairs();
+		MonomialSet monomials;
+		std::vector<RowSpec> specs = symbolicPreprocessing(selected, monomials);
+
+		// The first column corresponds to the largest monomial.
+		std::vector<Monomial::Arg> columnMonomials(monomials.rbegin(), monomials.rend());
+		std::map<Monomial::Arg, std::size_t, MonomialLess> columns;
+		for(std::size_t i = 0; i < columnMonomials.size(); ++i)
+		{
+			columns.emplace(columnMonomials[i], i);
+		}
+
+		std::vector<Row> rows;
+		rows.reserve(specs.size());
+		for(const RowSpec& spec : specs)
+		{
+			const Polynomial& p = this->pGb->getGenerators()[spec.first];
+			Row row;
+			row.mReasons = p.getReasons();
+			row.mEntries.reserve(p.nrTerms());
+			for(const auto& term : p)
+			{
+				row.mEntries.emplace_back(columns.at(term.monomial() * spec.second), term.coeff());
+			}
+			// The terms of a polynomial are only guaranteed to be minimally ordered.
+			std::sort(row.mEntries.begin(), row.mEntries.end(), [](const std::pair<std::size_t, Coeff>& lhs, const std::pair<std::size_t, Coeff>& rhs){ return lhs.first < rhs.first; });
+			rows.push_back(std::move(row));
+		}
+		CARL_LOG_DEBUG("carl.gb.f4", "Macaulay matrix with " << rows.size() << " rows and " << columnMonomials.size() << " columns for " << selected.size() / 2 << " pairs");
+
+		std::size_t zeroRows = 0;
+		std::vector<Row> reduced = reduceMatrix(rows, zeroRows);
+#ifdef BUCHBERGER_STATISTICS
+		// Every row which is reduced to zero or to a row with a new leading monomial counts as a reduced S-polynomial.
+		for(std::size_t i = 0; i < reduced.size(); ++i)
+		{
+			this->mStats->TreatSPair();
+			this->mStats->NonZeroReduction();
+		}
+		for(std::size_t i = 0; i < zeroRows; ++i)
+		{
+			this->mStats->TreatSPair();
+			this->mStats->ZeroReduction();
+		}
+#endif
+		CARL_LOG_DEBUG("carl.gb.f4", reduced.size() << " new rows, " << zeroRows << " rows reduced to zero");
+		for(const Row& row : reduced)
+		{
+			typename Polynomial::TermsType terms;
+			terms.reserve(row.mEntries.size());
+			for(auto it = row.mEntries.rbegin(); it != row.mEntries.rend(); ++it)
+			{
+				terms.emplace_back(it->second, columnMonomials[it->first]);
+			}
+			Polynomial newPol(std::move(terms), false, true);
+			newPol.setReasons(row.mReasons);
+			CARL_LOG_DEBUG("carl.gb.f4", "New basis element: " << newPol);
+			if(this->addToGb(newPol))
+			{
+				foundGB = true;
+				break;
+			}
+		}
+	}
+	this->mGbElementsIndices.clear();
+	this->mSugar.clear();
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+std::vector<typename F4<Polynomial, AddingPolicy>::RowSpec> F4<Polynomial, AddingPolicy>::selectPairs()
+{
+	const std::vector<Polynomial>& generators = this->pGb->getGenerators();
+	std::set<RowSpec> seen;
+	std::vector<RowSpec> rows;
+	auto degree = this->pCritPairs->topLcm()->tdeg();
+	while(!this->pCritPairs->empty() && this->pCritPairs->topLcm()->tdeg() == degree)
+	{
+		SPolPair critPair = this->pCritPairs->pop();
+		assert(critPair.mP1 < generators.size());
+		assert(critPair.mP2 < generators.size());
+		CARL_LOG_DEBUG("carl.gb.f4", "Select pair " << generators[critPair.mP1] << ", " << generators[critPair.mP2]);
+		for(std::size_t index : {critPair.mP1, critPair.mP2})
+		{
+			Monomial::Arg factor;
+			bool divides = critPair.mLcm->divide(generators[index].lmon(), factor);
+			assert(divides);
+			(void)divides;
+			if(seen.emplace(index, factor).second)
+			{
+				rows.emplace_back(index, factor);
+			}
+		}
+	}
+	return rows;
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+std::vector<typename F4<Polynomial, AddingPolicy>::RowSpec> F4<Polynomial, AddingPolicy>::symbolicPreprocessing(const std::vector<RowSpec>& rows, MonomialSet& monomials) const
+{
+	const std::vector<Polynomial>& generators = this->pGb->getGenerators();
+	// Monomials which are leading monomials of some row.
+	MonomialSet done;
+	std::vector<Monomial::Arg> todo;
+	auto addMonomials = [&](const RowSpec& spec)
+	{
+		for(const auto& term : generators[spec.first])
+		{
+			Monomial::Arg m = term.monomial() * spec.second;
+			if(monomials.insert(m).second)
+			{
+				todo.push_back(m);
+			}
+		}
+	};
+	for(const RowSpec& spec : rows)
+	{
+		done.insert(generators[spec.first].lmon() * spec.second);
+		addMonomials(spec);
+	}
+
+	std::vector<RowSpec> reducers;
+	while(!todo.empty())
+	{
+		Monomial::Arg m = todo.back();
+		todo.pop_back();
+		if(!m || !done.insert(m).second) continue;
+		DivisionLookupResult<Polynomial> divisor = this->pGb->getDivisor(Term<Coeff>(constant_one<Coeff>::get(), m));
+		if(divisor.mDivisor == nullptr) continue;
+		Monomial::Arg factor;
+		bool divides = m->divide(divisor.mDivisor->lmon(), factor);
+		assert(divides);
+		(void)divides;
+		RowSpec spec(std::size_t(divisor.mDivisor - generators.data()), factor);
+		addMonomials(spec);
+		reducers.push_back(spec);
+	}
+	CARL_LOG_TRACE("carl.gb.f4", "Symbolic preprocessing added " << reducers.size() << " reducers");
+	reducers.insert(reducers.end(), rows.begin(), rows.end());
+	return reducers;
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+std::vector<typename F4<Polynomial, AddingPolicy>::Row> F4<Polynomial, AddingPolicy>::reduceMatrix(std::vector<Row>& rows, std::size_t& zeroRows) const
+{
+	zeroRows = 0;
+	std::set<std::size_t> leadingColumns;
+	for(const Row& row : rows)
+	{
+		assert(!row.mEntries.empty());
+		leadingColumns.insert(row.mEntries.front().first);
+	}
+
+	// Maps columns to the index of the row which has its leading coefficient in this column.
+	std::map<std::size_t, std::size_t> pivots;
+	std::vector<Row> result;
+	for(std::size_t r = 0; r < rows.size(); ++r)
+	{
+		Row& row = rows[r];
+		std::size_t pos = 0;
+		while(pos < row.mEntries.size())
+		{
+			auto pivot = pivots.find(row.mEntries[pos].first);
+			if(pivot == pivots.end())
+			{
+				++pos;
+				continue;
+			}
+			Coeff factor = row.mEntries[pos].second;
+			subtractMultiple(row, factor, rows[pivot->second]);
+		}
+		if(row.mEntries.empty())
+		{
+			++zeroRows;
+			continue;
+		}
+
+		Coeff lcoeff = row.mEntries.front().second;
+		if(lcoeff != constant_one<Coeff>::get())
+		{
+			for(auto& entry : row.mEntries)
+			{
+				entry.second /= lcoeff;
+			}
+		}
+		pivots.emplace(row.mEntries.front().first, r);
+		if(leadingColumns.count(row.mEntries.front().first) == 0)
+		{
+			result.push_back(row);
+		}
+	}
+	return result;
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+void F4<Polynomial, AddingPolicy>::subtractMultiple(Row& lhs, const Coeff& factor, const Row& rhs)
+{
+	std::vector<std::pair<std::size_t, Coeff>> entries;
+	entries.reserve(lhs.mEntries.size() + rhs.mEntries.size());
+	auto l = lhs.mEntries.begin();
+	auto r = rhs.mEntries.begin();
+	while(l != lhs.mEntries.end() || r != rhs.mEntries.end())
+	{
+		if(r == rhs.mEntries.end() || (l != lhs.mEntries.end() && l->first < r->first))
+		{
+			entries.push_back(*l);
+			++l;
+		}
+		else if(l == lhs.mEntries.end() || r->first < l->first)
+		{
+			entries.emplace_back(r->first, -(factor * r->second));
+			++r;
+		}
+		else
+		{
+			Coeff c = l->second - factor * r->second;
+			if(!carl::isZero(c))
+			{
+				entries.emplace_back(l->first, c);
+			}
+			++l;
+			++r;
+		}
+	}
+	lhs.mEntries.swap(entries);
+	lhs.mReasons = lhs.mReasons | rhs.mReasons;
+}
+
+}
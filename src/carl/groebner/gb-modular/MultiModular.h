@@ -0,0 +1,146 @@
+/**
+ * @file   MultiModular.h
+ * @ingroup gb
+ *
+ */
+
+#pragma once
+
+#include "../GBProcedure.h"
+#include "../gb-f4/F4.h"
+#include "../../numbers/GFNumber.h"
+#include "../../numbers/PrimeFactory.h"
+
+#include <map>
+#include <type_traits>
+#include <vector>
+
+namespace carl
+{
+
+/**
+ * Standard settings for the multi-modular computation of Groebner bases.
+ * @ingroup gb
+ */
+struct DefaultMultiModularSettings
+{
+	/**
+	 * If true, the reconstructed basis is checked over the rationals, otherwise modulo an additional prime.
+	 * The check over the rationals only ensures that the basis is a Groebner basis whose ideal contains the input,
+	 * it does not ensure that the basis lies in the ideal of the input.
+	 */
+	static const bool rationalVerification = true;
+	/// The primes are the consecutive primes above this number.
+	static const unsigned firstPrime = 2147483648u;
+	/// The number of primes after which the procedure falls back to the computation over the rationals.
+	static const std::size_t maxPrimes = 64;
+};
+
+/**
+ * Settings for the multi-modular computation which only verify the result modulo an additional prime.
+ * @ingroup gb
+ */
+struct ProbabilisticMultiModularSettings : DefaultMultiModularSettings
+{
+	static const bool rationalVerification = false;
+};
+
+/**
+ * Multi-modular computation of Groebner bases over the rationals.
+ *
+ * The reduced Groebner basis is computed with F4 modulo several primes, using GFNumber coefficients.
+ * Primes whose bases have a different set of leading monomials are detected as unlucky and discarded.
+ * The coefficients of the remaining bases are combined by the chinese remainder theorem and lifted to the
+ * rationals by rational reconstruction, until the reconstruction is stable and passes the check selected by the settings.
+ * This avoids the growth of intermediate coefficients which occurs over the rationals.
+ *
+ * If the polynomials carry reason sets or the adding policy is not StdAdding, the basis is computed with F4 over the rationals.
+ * @ingroup gb
+ */
+template<typename Polynomial, template<typename> class AddingPolicy, typename Settings>
+class MultiModularProcedure : public F4<Polynomial, AddingPolicy>
+{
+	using Super = F4<Polynomial, AddingPolicy>;
+	using Coeff = typename Polynomial::CoeffType;
+	using Integer = typename IntegralType<Coeff>::type;
+	using ModularPolynomial = MultivariatePolynomial<GFNumber<Integer>, typename Polynomial::OrderedBy>;
+
+	/**
+	 * Orders monomials according to the ordering of the polynomials.
+	 */
+	struct MonomialLess
+	{
+		bool operator()(const Monomial::Arg& lhs, const Monomial::Arg& rhs) const
+		{
+			return Polynomial::OrderedBy::less(lhs, rhs);
+		}
+	};
+	/// The coefficients of a polynomial, as residues or as rationals.
+	template<typename C>
+	using CoefficientMap = std::map<Monomial::Arg, C, MonomialLess>;
+
+public:
+	MultiModularProcedure() = default;
+	MultiModularProcedure(const MultiModularProcedure& rhs) = default;
+	~MultiModularProcedure() override = default;
+
+	void calculate(const std::list<Polynomial>& scheduledForAdding);
+
+protected:
+	/**
+	 * Computes the reduced Groebner basis of the given polynomials with integral coefficients.
+	 * @param input Polynomials.
+	 * @param result Receives the basis, sorted by leading monomials.
+	 * @return false, if no stable reconstruction was found with the allowed number of primes.
+	 */
+	bool modularBasis(const std::vector<Polynomial>& input, std::vector<Polynomial>& result) const;
+
+	/**
+	 * Computes the reduced Groebner basis modulo a prime.
+	 * @param input Polynomials.
+	 * @param gf The field.
+	 * @param result Receives the basis, sorted by leading monomials.
+	 * @return false, if the prime divides a leading coefficient of the input.
+	 */
+	static bool basisModulo(const std::vector<Polynomial>& input, const GaloisField<Integer>* gf, std::vector<ModularPolynomial>& result);
+
+	/**
+	 * Checks whether the given basis is a Groebner basis of an ideal containing the input.
+	 * This is a partial check: a basis of a strictly larger ideal passes as well.
+	 */
+	static bool isGroebnerBasisOfSuperideal(const std::vector<Polynomial>& input, const std::vector<Polynomial>& basis);
+
+	/**
+	 * Checks whether the given basis coincides with the given basis modulo the prime.
+	 */
+	static bool matches(const std::vector<Polynomial>& basis, const std::vector<ModularPolynomial>& image, const GaloisField<Integer>* gf);
+
+	/**
+	 * Computes x with x = a mod m and x = b mod p, in the symmetric range modulo m*p.
+	 */
+	static Integer chineseRemainder(const Integer& a, const Integer& m, const Integer& b, const GaloisField<Integer>* gf);
+
+	/**
+	 * Computes the rational number n/d with n/d = a mod m and |n|, |d| <= sqrt(m/2), if it exists.
+	 * @return false, if no such number exists.
+	 */
+	static bool rationalReconstruction(const Integer& a, const Integer& m, Coeff& result);
+};
+
+/**
+ * Multi-modular Groebner bases, checked over the rationals to be a Groebner basis of an ideal containing the input.
+ * @ingroup gb
+ */
+template<typename Polynomial, template<typename> class AddingPolicy>
+using MultiModular = MultiModularProcedure<Polynomial, AddingPolicy, DefaultMultiModularSettings>;
+
+/**
+ * Multi-modular Groebner bases, verified modulo an additional prime.
+ * @ingroup gb
+ */
+template<typename Polynomial, template<typename> class AddingPolicy>
+using ProbabilisticMultiModular = MultiModularProcedure<Polynomial, AddingPolicy, ProbabilisticMultiModularSettings>;
+
+}
+
+#include "MultiModular.tpp"
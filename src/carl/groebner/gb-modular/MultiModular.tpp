@@ -0,0 +1,280 @@
+/**
+ * @file MultiModular.tpp
+ * @ingroup gb
+ */
+#pragma once
+#include "MultiModular.h"
+
+namespace carl
+{
+
+/**
+ * Calculate the Groebner basis
+ */
+template<class Polynomial, template<typename> class AddingPolicy, typename Settings>
+void MultiModularProcedure<Polynomial, AddingPolicy, Settings>::calculate(const std::list<Polynomial>& scheduledForAdding)
+{
+	if(Polynomial::Policy::has_reasons || !std::is_same<AddingPolicy<Polynomial>, StdAdding<Polynomial>>::value)
+	{
+		Super::calculate(scheduledForAdding);
+		return;
+	}
+	CARL_LOG_INFO("carl.gb.modular", "Calculate gb");
+	std::vector<Polynomial> input;
+	for(const Polynomial& p : this->pGb->getGenerators())
+	{
+		input.push_back(p.coprimeCoefficients());
+	}
+	for(const Polynomial& p : scheduledForAdding)
+	{
+		if(!p.isZero()) input.push_back(p.coprimeCoefficients());
+	}
+	if(input.empty()) return;
+
+	std::vector<Polynomial> basis;
+	if(!modularBasis(input, basis))
+	{
+		CARL_LOG_WARN("carl.gb.modular", "No stable reconstruction with " << Settings::maxPrimes << " primes, falling back to the rationals.");
+		Super::calculate(scheduledForAdding);
+		return;
+	}
+	this->pGb->clear();
+	for(const Polynomial& p : basis)
+	{
+		this->pGb->addGenerator(p);
+	}
+}
+
+template<class Polynomial, template<typename> class AddingPolicy, typename Settings>
+bool MultiModularProcedure<Polynomial, AddingPolicy, Settings>::modularBasis(const std::vector<Polynomial>& input, std::vector<Polynomial>& result) const
+{
+	// Checks whether the monomial ideal generated by lhs contains all of rhs.
+	auto contains = [](const std::vector<Monomial::Arg>& lhs, const std::vector<Monomial::Arg>& rhs)
+	{
+		return std::all_of(rhs.begin(), rhs.end(), [&lhs](const Monomial::Arg& m)
+		{
+			return std::any_of(lhs.begin(), lhs.end(), [&m](const Monomial::Arg& d)
+			{
+				return !d || (m && m->divisible(d));
+			});
+		});
+	};
+
+	PrimeFactory<Integer> primes;
+	Integer prime(Settings::firstPrime);
+	Integer modulus(1);
+	std::vector<Monomial::Arg> leadingMonomials;
+	std::vector<CoefficientMap<Integer>> residues;
+	std::vector<Polynomial> candidate;
+	for(std::size_t n = 0; n < Settings::maxPrimes; ++n)
+	{
+		prime = detail::next_prime(prime, primes);
+		const GaloisField<Integer>* gf = GaloisFieldManager<Integer>::getInstance().getField(unsigned(toInt<uint>(prime)));
+		std::vector<ModularPolynomial> image;
+		if(!basisModulo(input, gf, image))
+		{
+			CARL_LOG_DEBUG("carl.gb.modular", "Skip " << *gf << ", it divides a leading coefficient");
+			continue;
+		}
+		std::vector<Monomial::Arg> monomials;
+		for(const ModularPolynomial& p : image)
+		{
+			monomials.push_back(p.lmon());
+		}
+
+		if(!residues.empty() && monomials != leadingMonomials)
+		{
+			// Keep the larger leading monomial ideal, which stems from lucky primes:
+			// the new image is discarded if its leading monomials generate a smaller or an incomparable monomial ideal,
+			// otherwise the previous primes were unlucky.
+			if(contains(leadingMonomials, monomials) || !contains(monomials, leadingMonomials))
+			{
+				CARL_LOG_DEBUG("carl.gb.modular", "Discard unlucky " << *gf);
+				continue;
+			}
+			CARL_LOG_DEBUG("carl.gb.modular", "Discard " << residues.size() << " residues of previous unlucky primes");
+			residues.clear();
+			candidate.clear();
+		}
+		if(residues.empty())
+		{
+			leadingMonomials = monomials;
+			residues.resize(image.size());
+			modulus = 1;
+		}
+
+		for(std::size_t i = 0; i < image.size(); ++i)
+		{
+			CoefficientMap<Integer> coefficients;
+			for(const auto& term : image[i])
+			{
+				coefficients.emplace(term.monomial(), term.coeff().representingInteger());
+				residues[i].emplace(term.monomial(), Integer(0));
+			}
+			for(auto& residue : residues[i])
+			{
+				auto it = coefficients.find(residue.first);
+				residue.second = chineseRemainder(residue.second, modulus, it == coefficients.end() ? Integer(0) : it->second, gf);
+			}
+		}
+		modulus *= prime;
+
+		std::vector<Polynomial> reconstructed;
+		bool reconstructable = true;
+		for(std::size_t i = 0; reconstructable && i < residues.size(); ++i)
+		{
+			typename Polynomial::TermsType terms;
+			for(const auto& residue : residues[i])
+			{
+				if(carl::isZero(residue.second)) continue;
+				Coeff c;
+				if(!rationalReconstruction(residue.second, modulus, c))
+				{
+					reconstructable = false;
+					break;
+				}
+				terms.emplace_back(c, residue.first);
+			}
+			reconstructed.emplace_back(std::move(terms));
+		}
+		if(!reconstructable) continue;
+		// Only verify once the reconstruction did not change for an additional prime.
+		if(reconstructed != candidate)
+		{
+			candidate.swap(reconstructed);
+			continue;
+		}
+		CARL_LOG_DEBUG("carl.gb.modular", "Stable reconstruction after " << n + 1 << " primes");
+
+		bool verified = false;
+		if(Settings::rationalVerification)
+		{
+			verified = isGroebnerBasisOfSuperideal(input, candidate);
+		}
+		else
+		{
+			std::vector<ModularPolynomial> check;
+			do
+			{
+				prime = detail::next_prime(prime, primes);
+				gf = GaloisFieldManager<Integer>::getInstance().getField(unsigned(toInt<uint>(prime)));
+			} while(!basisModulo(input, gf, check));
+			verified = matches(candidate, check, gf);
+		}
+		if(verified)
+		{
+			result.swap(candidate);
+			return true;
+		}
+		CARL_LOG_DEBUG("carl.gb.modular", "Verification failed");
+		candidate.clear();
+	}
+	return false;
+}
+
+template<class Polynomial, template<typename> class AddingPolicy, typename Settings>
+bool MultiModularProcedure<Polynomial, AddingPolicy, Settings>::basisModulo(const std::vector<Polynomial>& input, const GaloisField<Integer>* gf, std::vector<ModularPolynomial>& result)
+{
+	GBProcedure<ModularPolynomial, F4, StdAdding> gb;
+	for(const Polynomial& p : input)
+	{
+		typename ModularPolynomial::TermsType terms;
+		for(const auto& term : p)
+		{
+			GFNumber<Integer> c(carl::getNum(term.coeff()), gf);
+			if(!c.isZero()) terms.emplace_back(c, term.monomial());
+		}
+		if(terms.empty()) return false;
+		ModularPolynomial q(std::move(terms), false, false);
+		if(q.lmon() != p.lmon()) return false;
+		gb.addPolynomial(q);
+	}
+	gb.calculate();
+	result = gb.getBasisPolynomials();
+	std::sort(result.begin(), result.end(), [](const ModularPolynomial& lhs, const ModularPolynomial& rhs){ return Polynomial::OrderedBy::less(lhs.lmon(), rhs.lmon()); });
+	return true;
+}
+
+template<class Polynomial, template<typename> class AddingPolicy, typename Settings>
+bool MultiModularProcedure<Polynomial, AddingPolicy, Settings>::isGroebnerBasisOfSuperideal(const std::vector<Polynomial>& input, const std::vector<Polynomial>& basis)
+{
+	Ideal<Polynomial> ideal;
+	for(const Polynomial& g : basis)
+	{
+		ideal.addGenerator(g);
+	}
+	for(std::size_t i = 0; i < basis.size(); ++i)
+	{
+		for(std::size_t j = i + 1; j < basis.size(); ++j)
+		{
+			Reductor<Polynomial, Polynomial> reductor(ideal, Polynomial::SPolynomial(basis[i], basis[j]));
+			if(!reductor.fullReduce().isZero()) return false;
+		}
+	}
+	for(const Polynomial& f : input)
+	{
+		Reductor<Polynomial, Polynomial> reductor(ideal, f);
+		if(!reductor.fullReduce().isZero()) return false;
+	}
+	return true;
+}
+
+template<class Polynomial, template<typename> class AddingPolicy, typename Settings>
+bool MultiModularProcedure<Polynomial, AddingPolicy, Settings>::matches(const std::vector<Polynomial>& basis, const std::vector<ModularPolynomial>& image, const GaloisField<Integer>* gf)
+{
+	if(basis.size() != image.size()) return false;
+	for(std::size_t i = 0; i < basis.size(); ++i)
+	{
+		CoefficientMap<Integer> coefficients;
+		for(const auto& term : image[i])
+		{
+			coefficients.emplace(term.monomial(), term.coeff().representingInteger());
+		}
+		std::size_t found = 0;
+		for(const auto& term : basis[i])
+		{
+			GFNumber<Integer> denominator(carl::getDenom(term.coeff()), gf);
+			if(denominator.isZero()) return false;
+			GFNumber<Integer> c = GFNumber<Integer>(carl::getNum(term.coeff()), gf) / denominator;
+			if(c.isZero()) continue;
+			auto it = coefficients.find(term.monomial());
+			if(it == coefficients.end() || it->second != c.representingInteger()) return false;
+			++found;
+		}
+		if(found != coefficients.size()) return false;
+	}
+	return true;
+}
+
+template<class Polynomial, template<typename> class AddingPolicy, typename Settings>
+typename MultiModularProcedure<Polynomial, AddingPolicy, Settings>::Integer MultiModularProcedure<Polynomial, AddingPolicy, Settings>::chineseRemainder(const Integer& a, const Integer& m, const Integer& b, const GaloisField<Integer>* gf)
+{
+	GFNumber<Integer> t = GFNumber<Integer>(Integer(b - a), gf) / GFNumber<Integer>(m, gf);
+	return a + m * t.representingInteger();
+}
+
+template<class Polynomial, template<typename> class AddingPolicy, typename Settings>
+bool MultiModularProcedure<Polynomial, AddingPolicy, Settings>::rationalReconstruction(const Integer& a, const Integer& m, Coeff& result)
+{
+	Integer r0 = m;
+	Integer r1 = carl::mod(a, m);
+	if(r1 < 0) r1 += m;
+	Integer s0(0);
+	Integer s1(1);
+	while(2 * r1 * r1 > m)
+	{
+		Integer q = carl::quotient(r0, r1);
+		Integer r = r0 - q * r1;
+		r0 = r1;
+		r1 = r;
+		Integer s = s0 - q * s1;
+		s0 = s1;
+		s1 = s;
+	}
+	if(2 * s1 * s1 > m) return false;
+	if(carl::gcd(r1, Integer(carl::abs(s1))) != 1) return false;
+	result = Coeff(r1) / Coeff(s1);
+	return true;
+}
+
+}
@@ -0,0 +1,185 @@
+/**
+ * @file   SignatureBased.h
+ * @ingroup gb
+ *
+ */
+
+#pragma once
+
+#include "../gb-buchberger/Buchberger.h"
+
+#include <queue>
+#include <vector>
+
+namespace carl
+{
+
+/**
+ * Signature-based computation of Groebner bases, in the rewrite basis formulation of Eder and Roune.
+ *
+ * Every element of the basis is labeled by its signature, the leading term m*e_i of a representation
+ * in terms of the input polynomials f_1, ..., f_n. Signatures are ordered position over term,
+ * that is, the input polynomials are processed incrementally.
+ * Instead of S-polynomials, the procedure considers J-pairs t*g, the multiple of the element with the larger signature,
+ * and reduces them only by reducers of smaller signature.
+ * A J-pair is discarded without reduction if
+ *  - its signature is divisible by the signature of a known syzygy, i.e. a principal (Koszul) syzygy or a reduction to zero,
+ *  - its signature is divisible by the signature of an element which was added later than the one the pair stems from,
+ *  - another J-pair with the same signature was already reduced, or
+ *  - it can be top reduced by a reducer with the same signature.
+ * Hence, most S-polynomials which reduce to zero are not reduced at all.
+ *
+ * Reason sets are maintained during the reduction, just like in Buchberger.
+ * If the adding policy is not StdAdding, the basis is computed with Buchberger, as other adding policies
+ * replace polynomials by polynomials whose signature is unknown.
+ * @ingroup gb
+ */
+template<typename Polynomial, template<typename> class AddingPolicy>
+class SignatureBased : public Buchberger<Polynomial, AddingPolicy>
+{
+	using Super = Buchberger<Polynomial, AddingPolicy>;
+	using Coeff = typename Polynomial::CoeffType;
+
+	/**
+	 * The signature m*e_i.
+	 * The monomial nullptr represents one.
+	 */
+	struct Signature
+	{
+		std::size_t mIndex;
+		Monomial::Arg mMonomial;
+
+		Signature(std::size_t index, Monomial::Arg monomial): mIndex(index), mMonomial(std::move(monomial)) {}
+
+		/// The signature t*m*e_i.
+		Signature operator*(const Monomial::Arg& t) const
+		{
+			return Signature(mIndex, mMonomial * t);
+		}
+		/// Position over term.
+		CompareResult compare(const Signature& rhs) const
+		{
+			if(mIndex < rhs.mIndex) return CompareResult::LESS;
+			if(mIndex > rhs.mIndex) return CompareResult::GREATER;
+			return Polynomial::OrderedBy::compare(mMonomial, rhs.mMonomial);
+		}
+		bool operator<(const Signature& rhs) const
+		{
+			return compare(rhs) == CompareResult::LESS;
+		}
+		bool operator==(const Signature& rhs) const
+		{
+			return compare(rhs) == CompareResult::EQUAL;
+		}
+		/// Checks whether this signature is a multiple of the given signature.
+		bool divisible(const Signature& rhs) const
+		{
+			return mIndex == rhs.mIndex && SignatureBased::divisible(mMonomial, rhs.mMonomial);
+		}
+	};
+
+	/**
+	 * An element of the basis together with its signature.
+	 */
+	struct LabeledPolynomial
+	{
+		Signature mSignature;
+		Polynomial mPolynomial;
+	};
+
+	/**
+	 * The J-pair mMultiple*g, where g is the element with index mElement.
+	 * For the input polynomials, mElement is mInput.
+	 */
+	struct JPair
+	{
+		Signature mSignature;
+		Monomial::Arg mMultiple;
+		std::size_t mElement;
+
+		/// The pairs with the smallest signature are processed first.
+		bool operator<(const JPair& rhs) const
+		{
+			return rhs.mSignature < mSignature;
+		}
+	};
+	static const std::size_t mInput = std::size_t(-1);
+
+	/// The elements of the basis, in the order of their insertion.
+	std::vector<LabeledPolynomial> mBasis;
+	/// Signatures of known syzygies.
+	std::vector<Signature> mSyzygies;
+	/// The J-pairs which are not yet processed.
+	std::priority_queue<JPair> mPairs;
+	/// The number of J-pairs reduced during the last call to calculate().
+	std::size_t mNrReductions = 0;
+	/// The number of J-pairs reduced to zero during the last call to calculate().
+	std::size_t mNrZeroReductions = 0;
+
+public:
+	SignatureBased() = default;
+	SignatureBased(const SignatureBased& rhs) = default;
+	~SignatureBased() override = default;
+
+	void calculate(const std::list<Polynomial>& scheduledForAdding);
+
+	/**
+	 * The number of J-pairs which were reduced during the last call to calculate().
+	 */
+	std::size_t nrReductions() const
+	{
+		return mNrReductions;
+	}
+
+	/**
+	 * The number of J-pairs which were reduced to zero during the last call to calculate().
+	 * This is zero if the input is a regular sequence.
+	 */
+	std::size_t nrZeroReductions() const
+	{
+		return mNrZeroReductions;
+	}
+
+protected:
+	/**
+	 * Checks whether a J-pair can be discarded by the syzygy or the rewrite criterion.
+	 */
+	bool isRedundant(const JPair& pair) const;
+
+	/**
+	 * Reduces the given polynomial by reducers whose signature is smaller than the given signature.
+	 * @param p The polynomial.
+	 * @param signature The signature of p.
+	 * @param singular Set to true if the leading term can only be reduced by a reducer with the same signature.
+	 * @return The reduced polynomial.
+	 */
+	Polynomial regularReduce(Polynomial p, const Signature& signature, bool& singular) const;
+
+	/**
+	 * Adds a new element of the basis, its J-pairs and its principal syzygies.
+	 */
+	void addElement(const Signature& signature, Polynomial p);
+
+	/**
+	 * Checks whether m is divisible by d.
+	 */
+	static bool divisible(const Monomial::Arg& m, const Monomial::Arg& d)
+	{
+		return !d || (m && m->divisible(d));
+	}
+	/**
+	 * Computes m / d, if d divides m.
+	 */
+	static Monomial::Arg divide(const Monomial::Arg& m, const Monomial::Arg& d)
+	{
+		assert(divisible(m, d));
+		if(!d) return m;
+		Monomial::Arg res;
+		m->divide(d, res);
+		return res;
+	}
+};
+
+}
+
+#include "SignatureBased.tpp"
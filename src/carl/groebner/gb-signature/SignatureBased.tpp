@@ -0,0 +1,207 @@
+/**
+ * @file SignatureBased.tpp
+ * @ingroup gb
+ */
+#pragma once
+#include "SignatureBased.h"
+
+namespace carl
+{
+
+/**
+ * Calculate the Groebner basis
+ */
+template<class Polynomial, template<typename> class AddingPolicy>
+void SignatureBased<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>& scheduledForAdding)
+{
+	mNrReductions = 0;
+	mNrZeroReductions = 0;
+	if(!std::is_same<AddingPolicy<Polynomial>, StdAdding<Polynomial>>::value)
+	{
+		Super::calculate(scheduledForAdding);
+		return;
+	}
+	CARL_LOG_INFO("carl.gb.signature", "Calculate gb");
+	std::vector<Polynomial> input(this->pGb->getGenerators());
+	for(const Polynomial& p : scheduledForAdding)
+	{
+		if(!p.isZero()) input.push_back(p);
+	}
+	mBasis.clear();
+	mSyzygies.clear();
+	for(std::size_t i = 0; i < input.size(); ++i)
+	{
+		mPairs.push(JPair{Signature(i, nullptr), nullptr, mInput});
+	}
+
+	// The signature of the last reduced pair.
+	std::unique_ptr<Signature> last;
+	while(!mPairs.empty())
+	{
+		JPair pair = mPairs.top();
+		mPairs.pop();
+		if(last && pair.mSignature == *last) continue;
+		if(isRedundant(pair)) continue;
+
+		Polynomial p;
+		if(pair.mElement == mInput)
+		{
+			p = input[pair.mSignature.mIndex];
+		}
+		else
+		{
+			const Polynomial& g = mBasis[pair.mElement].mPolynomial;
+			p = g * pair.mMultiple;
+			p.setReasons(g.getReasons());
+		}
+		bool singular = false;
+		Polynomial remainder = regularReduce(std::move(p), pair.mSignature, singular);
+		if(singular) continue;
+		last.reset(new Signature(pair.mSignature));
+		++mNrReductions;
+#ifdef BUCHBERGER_STATISTICS
+		this->mStats->TreatSPair();
+		if(remainder.isZero()) this->mStats->ZeroReduction();
+		else this->mStats->NonZeroReduction();
+#endif
+
+		if(remainder.isZero())
+		{
+			CARL_LOG_DEBUG("carl.gb.signature", "Reduction to zero in signature " << pair.mSignature.mIndex << ", " << pair.mSignature.mMonomial);
+			++mNrZeroReductions;
+			mSyzygies.push_back(pair.mSignature);
+		}
+		else if(remainder.isConstant())
+		{
+			CARL_LOG_INFO("carl.gb.signature", "Found a constant polynomial.");
+			mBasis.clear();
+			mBasis.push_back(LabeledPolynomial{pair.mSignature, remainder});
+			break;
+		}
+		else
+		{
+			addElement(pair.mSignature, remainder.normalize());
+		}
+	}
+	CARL_LOG_INFO("carl.gb.signature", mNrReductions << " reductions, " << mNrZeroReductions << " to zero");
+
+	this->pGb->clear();
+	for(const LabeledPolynomial& g : mBasis)
+	{
+		if(g.mPolynomial.isConstant())
+		{
+			Polynomial q(1);
+			q.setReasons(g.mPolynomial.getReasons());
+			this->pGb->addGenerator(q);
+		}
+		else
+		{
+			this->pGb->addGenerator(g.mPolynomial);
+		}
+	}
+	mBasis.clear();
+	mSyzygies.clear();
+	mPairs = std::priority_queue<JPair>();
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+bool SignatureBased<Polynomial, AddingPolicy>::isRedundant(const JPair& pair) const
+{
+	for(const Signature& syzygy : mSyzygies)
+	{
+		if(pair.mSignature.divisible(syzygy))
+		{
+			CARL_LOG_TRACE("carl.gb.signature", "Syzygy criterion");
+			return true;
+		}
+	}
+	if(pair.mElement == mInput) return false;
+	for(std::size_t i = pair.mElement + 1; i < mBasis.size(); ++i)
+	{
+		if(pair.mSignature.divisible(mBasis[i].mSignature))
+		{
+			CARL_LOG_TRACE("carl.gb.signature", "Rewrite criterion");
+			return true;
+		}
+	}
+	return false;
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+Polynomial SignatureBased<Polynomial, AddingPolicy>::regularReduce(Polynomial p, const Signature& signature, bool& singular) const
+{
+	BitVector reasons = p.getReasons();
+	typename Polynomial::TermsType remainder;
+	while(!p.isZero())
+	{
+		Term<Coeff> lt = p.lterm();
+		const LabeledPolynomial* reducer = nullptr;
+		Monomial::Arg factor;
+		for(const LabeledPolynomial& g : mBasis)
+		{
+			if(!divisible(lt.monomial(), g.mPolynomial.lmon())) continue;
+			Monomial::Arg t = divide(lt.monomial(), g.mPolynomial.lmon());
+			CompareResult cmp = (g.mSignature * t).compare(signature);
+			if(cmp == CompareResult::LESS)
+			{
+				reducer = &g;
+				factor = t;
+				break;
+			}
+			if(cmp == CompareResult::EQUAL && remainder.empty())
+			{
+				singular = true;
+			}
+		}
+		if(reducer == nullptr)
+		{
+			if(singular) return Polynomial();
+			remainder.push_back(lt);
+			p.stripLT();
+			continue;
+		}
+		singular = false;
+		// The elements of the basis are monic.
+		p.subtractProduct(Term<Coeff>(lt.coeff(), factor), reducer->mPolynomial);
+		reasons = reasons | reducer->mPolynomial.getReasons();
+	}
+	Polynomial result(std::move(remainder), false, false);
+	result.setReasons(reasons);
+	return result;
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+void SignatureBased<Polynomial, AddingPolicy>::addElement(const Signature& signature, Polynomial p)
+{
+	CARL_LOG_DEBUG("carl.gb.signature", "New basis element " << p << " with signature " << signature.mIndex << ", " << signature.mMonomial);
+	std::size_t index = mBasis.size();
+	for(std::size_t i = 0; i < index; ++i)
+	{
+		const LabeledPolynomial& g = mBasis[i];
+		// The principal syzygy of g and p.
+		Signature sg = g.mSignature * p.lmon();
+		Signature sp = signature * g.mPolynomial.lmon();
+		if(!(sg == sp))
+		{
+			mSyzygies.push_back(sg < sp ? sp : sg);
+		}
+
+		Monomial::Arg lcm = Monomial::lcm(g.mPolynomial.lmon(), p.lmon());
+		Monomial::Arg tg = divide(lcm, g.mPolynomial.lmon());
+		Monomial::Arg tp = divide(lcm, p.lmon());
+		sg = g.mSignature * tg;
+		sp = signature * tp;
+		if(sg == sp) continue;
+		if(sg < sp)
+		{
+			mPairs.push(JPair{sp, tp, index});
+		}
+		else
+		{
+			mPairs.push(JPair{sg, tg, i});
+		}
+	}
+	mBasis.push_back(LabeledPolynomial{signature, std::move(p)});
+}
+
+}
@@ -9,4 +9,8 @@
 
 #include "GBProcedure.h"
 #include "gb-buchberger/Buchberger.h"
+#include "gb-buchberger/ParallelBuchberger.h"
+#include "gb-f4/F4.h"
+#include "gb-modular/MultiModular.h"
+#include "gb-signature/SignatureBased.h"
 #include "Reductor.h"
\ No newline at end of file
@@ -0,0 +1,252 @@
+/**
+ * @file:   IdealDSKDTree.h
+ *
+ */
+
+#pragma once
+
+#include "../../core/Term.h"
+#include "../../core/VariablePool.h"
+#include "../DivisionLookupResult.h"
+#include "PolynomialSorts.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+
+namespace carl
+{
+
+/**
+ * Divisor lookup which stores the leading monomials of the generators in a kd-tree.
+ *
+ * Every inner node splits its monomials by the exponent of a single variable,
+ * so a lookup only descends into the subtrees which may contain divisors.
+ * Within the leaves, a divisor mask is checked before the actual division:
+ * every variable sets two bits of the mask, one if it occurs and one if it occurs at least squared.
+ * A monomial can only divide another if its mask is a subset of the mask of the other.
+ *
+ * Among all divisors, the one which is the smallest with respect to the order of the leading terms is returned,
+ * just like IdealDatastructureVector does.
+ */
+template<class Polynomial>
+class IdealDatastructureKDTree
+{
+	using Mask = std::uint64_t;
+	/// The maximal number of generators in a leaf, unless they can not be split.
+	static const std::size_t mLeafSize = 8;
+
+	struct Node
+	{
+		/// Index of the child with smaller exponents, zero for leaves.
+		std::size_t mLower = 0;
+		/// Index of the child with greater exponents, zero for leaves.
+		std::size_t mUpper = 0;
+		Variable mVariable = Variable::NO_VARIABLE;
+		/// The generators in the upper child have at least this exponent.
+		exponent mThreshold = 0;
+		/// The generators in a leaf, sorted by their leading terms.
+		std::vector<std::size_t> mEntries;
+
+		bool isLeaf() const
+		{
+			return mLower == 0;
+		}
+	};
+
+public:
+
+	IdealDatastructureKDTree(const std::vector<Polynomial>& generators, const std::unordered_set<size_t>& eliminated, const sortByLeadingTerm<Polynomial>& order)
+	: mGenerators(generators), mEliminated(eliminated), mOrder(order), mNodes(1), mMasks()
+	{
+	}
+
+	IdealDatastructureKDTree(const IdealDatastructureKDTree& id)
+	: mGenerators(id.mGenerators), mEliminated(id.mEliminated), mOrder(id.mOrder), mNodes(id.mNodes), mMasks(id.mMasks)
+	{
+	}
+
+	virtual ~IdealDatastructureKDTree() = default;
+
+	/**
+	 * Should be called whenever an generator is added
+	 * @param fIndex
+	 */
+	void addGenerator(size_t fIndex) const
+	{
+		if(mMasks.size() <= fIndex) mMasks.resize(fIndex + 1);
+		mMasks[fIndex] = mask(mGenerators[fIndex].lmon());
+		std::size_t node = 0;
+		const Monomial::Arg& m = mGenerators[fIndex].lmon();
+		while(!mNodes[node].isLeaf())
+		{
+			node = exponentOf(m, mNodes[node].mVariable) < mNodes[node].mThreshold ? mNodes[node].mLower : mNodes[node].mUpper;
+		}
+		std::vector<std::size_t>& entries = mNodes[node].mEntries;
+		entries.insert(std::upper_bound(entries.begin(), entries.end(), fIndex, mOrder), fIndex);
+		if(entries.size() > mLeafSize) split(node);
+	}
+
+	/**
+	 *
+	 * @param t
+	 * @return A divisionresult [divisor, factor].
+	 *
+	 */
+	DivisionLookupResult<Polynomial> getDivisor(const Term<typename Polynomial::CoeffType>& t) const
+	{
+		std::size_t divisor = mGenerators.size();
+		find(0, t.monomial(), mask(t.monomial()), divisor);
+		if(divisor == mGenerators.size())
+		{
+			//no divisor found
+			return DivisionLookupResult<Polynomial>();
+		}
+		Term<typename Polynomial::CoeffType> divres;
+		bool divides = t.divide(mGenerators[divisor].lterm(), divres);
+		assert(divides);
+		(void)divides;
+		//To eliminate, we have to negate the factor.
+		divres.negate();
+		return DivisionLookupResult<Polynomial>(&mGenerators[divisor], divres);
+	}
+
+	bool isDividable(const Term<typename Polynomial::CoeffType>& t) const
+	{
+		std::size_t divisor = mGenerators.size();
+		find(0, t.monomial(), mask(t.monomial()), divisor);
+		return divisor != mGenerators.size();
+	}
+
+	/**
+	 * Should be called if the generator set is reset.
+	 */
+	void reset()
+	{
+		mNodes.assign(1, Node());
+		mMasks.clear();
+		for(size_t i = 0; i < mGenerators.size(); ++i)
+		{
+			if(mEliminated.count(i) == 0) addGenerator(i);
+		}
+	}
+
+private:
+	static exponent exponentOf(const Monomial::Arg& m, Variable::Arg v)
+	{
+		return m ? m->exponentOfVariable(v) : 0;
+	}
+
+	static Mask mask(const Monomial::Arg& m)
+	{
+		Mask res = 0;
+		if(!m) return res;
+		for(const auto& ve : *m)
+		{
+			std::size_t bit = 2 * (ve.first.getId() % (4 * sizeof(Mask)));
+			res |= Mask(1) << bit;
+			if(ve.second > 1) res |= Mask(1) << (bit + 1);
+		}
+		return res;
+	}
+
+	/**
+	 * Searches the subtree of the given node for the smallest divisor of m.
+	 * @param divisor The smallest divisor found so far, updated if a smaller one is found.
+	 */
+	void find(std::size_t node, const Monomial::Arg& m, Mask mMask, std::size_t& divisor) const
+	{
+		if(!mNodes[node].isLeaf())
+		{
+			find(mNodes[node].mLower, m, mMask, divisor);
+			if(exponentOf(m, mNodes[node].mVariable) >= mNodes[node].mThreshold)
+			{
+				find(mNodes[node].mUpper, m, mMask, divisor);
+			}
+			return;
+		}
+		std::vector<std::size_t>& entries = mNodes[node].mEntries;
+		for(auto it = entries.begin(); it != entries.end();)
+		{
+			// The generators before the current divisor can not be smaller.
+			if(divisor != mGenerators.size() && !mOrder(*it, divisor)) return;
+			if(mEliminated.count(*it) == 1)
+			{
+				it = entries.erase(it);
+				continue;
+			}
+			const Monomial::Arg& d = mGenerators[*it].lmon();
+			if((mMasks[*it] & ~mMask) == 0 && (!d || (m && m->divisible(d))))
+			{
+				divisor = *it;
+				return;
+			}
+			++it;
+		}
+	}
+
+	/**
+	 * Splits a leaf along the variable whose exponents vary the most.
+	 */
+	void split(std::size_t node) const
+	{
+		Variable variable = Variable::NO_VARIABLE;
+		exponent low = 0;
+		exponent high = 0;
+		for(std::size_t index : mNodes[node].mEntries)
+		{
+			const Monomial::Arg& m = mGenerators[index].lmon();
+			if(!m) continue;
+			for(const auto& ve : *m)
+			{
+				exponent min = ve.second;
+				exponent max = ve.second;
+				for(std::size_t other : mNodes[node].mEntries)
+				{
+					exponent e = exponentOf(mGenerators[other].lmon(), ve.first);
+					min = std::min(min, e);
+					max = std::max(max, e);
+				}
+				if(max - min > high - low)
+				{
+					variable = ve.first;
+					low = min;
+					high = max;
+				}
+			}
+		}
+		// All leading monomials are equal.
+		if(variable == Variable::NO_VARIABLE) return;
+
+		exponent threshold = low + (high - low + 1) / 2;
+		Node lower;
+		Node upper;
+		for(std::size_t index : mNodes[node].mEntries)
+		{
+			if(exponentOf(mGenerators[index].lmon(), variable) < threshold) lower.mEntries.push_back(index);
+			else upper.mEntries.push_back(index);
+		}
+		mNodes[node].mEntries.clear();
+		mNodes[node].mVariable = variable;
+		mNodes[node].mThreshold = threshold;
+		mNodes[node].mLower = mNodes.size();
+		mNodes.push_back(std::move(lower));
+		mNodes[node].mUpper = mNodes.size();
+		mNodes.push_back(std::move(upper));
+	}
+
+	/// A reference to the generators in the ideal
+	const std::vector<Polynomial>& mGenerators;
+	/// A reference to the indices of eliminated generators
+	const std::unordered_set<size_t>& mEliminated;
+	/// A object which orders the generators according their leading terms, given their indices
+	const sortByLeadingTerm<Polynomial>& mOrder;
+	// Has to be mutable, as generators are added and removed by const methods.
+	mutable std::vector<Node> mNodes;
+	/// The divisor masks of the leading monomials, indexed by the generators.
+	mutable std::vector<Mask> mMasks;
+};
+
+}
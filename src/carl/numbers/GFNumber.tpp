@@ -127,6 +127,7 @@ GFNumber<IntegerType>& GFNumber<IntegerType>::operator +=(const GFNumber& rhs)
 		mGf = rhs.mGf;
 	}
 	mN += rhs.mN;
+	if(mGf != nullptr) mN = mGf->symmetricModulo(mN);
 	return *this;
 }
 
@@ -168,9 +169,10 @@ GFNumber<IntegerType>& GFNumber<IntegerType>::operator -=(const GFNumber& rhs)
 	if(rhs.isZero()) return *this;
 	if(mGf == nullptr)
 	{
-		mGf == rhs.mGf;
+		mGf = rhs.mGf;
 	}
 	mN -= rhs.mN;
+	if(mGf != nullptr) mN = mGf->symmetricModulo(mN);
 	return *this;
 }
 
@@ -202,8 +204,13 @@ GFNumber<IntegerT> operator*(const IntegerT& lhs, const GFNumber<IntegerT>& rhs)
 template<typename IntegerT>
 GFNumber<IntegerT>& GFNumber<IntegerT>::operator *=(const GFNumber& rhs)
 {
-	assert(rhs.mGf == nullptr || *mGf == *(rhs.mGf));
+	assert(mGf == nullptr || rhs.mGf == nullptr || *mGf == *(rhs.mGf));
+	if(mGf == nullptr)
+	{
+		mGf = rhs.mGf;
+	}
 	mN *= rhs.mN;
+	if(mGf != nullptr) mN = mGf->symmetricModulo(mN);
 	return *this;
 }
 
@@ -219,6 +226,7 @@ template<typename IntegerT>
 GFNumber<IntegerT> operator/(const GFNumber<IntegerT>& lhs, const GFNumber<IntegerT>& rhs)
 {
 	assert(!rhs.isZero());
+	if(rhs.isUnit()) return lhs;
 	assert(rhs.mGf != nullptr);
 	return GFNumber<IntegerT>(lhs.mN * rhs.inverse().mN, rhs.mGf);
 }
@@ -228,7 +236,10 @@ template<typename IntegerT>
 GFNumber<IntegerT>& GFNumber<IntegerT>::operator /=(const GFNumber<IntegerT>& rhs)
 {
 	assert(!rhs.isZero());
-	mN * rhs.inverse().mN;
+	if(rhs.isUnit()) return *this;
+	assert(rhs.mGf != nullptr);
+	mGf = rhs.mGf;
+	mN = mGf->symmetricModulo(mN * rhs.inverse().mN);
 	return *this;
 }
 
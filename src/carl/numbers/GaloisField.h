@@ -81,6 +81,8 @@ private:
 	IntegerType symmetricModulo(const IntegerType& n) const	{
 		if (n > mMaxValue) {
 			return carl::mod(IntegerType(n-mModulus), mPK) - mMaxValue;
+		} else if (n < -mMaxValue) {
+			return -symmetricModulo(-n);
 		} else {
 			return carl::mod(n, mPK);
 		}
@@ -15,6 +15,7 @@
 #include <cmath>
 #include <iterator>
 #include <list>
+#include <map>
 #include <queue>
 
 
@@ -31,6 +32,15 @@ private:
 	// {0,1,2} in order to perform sign determination
 	using Alpha = std::list<uint>;
 	
+	// everything getSigns computes for a polynomial w.r.t. the current state
+	struct CachedResult {
+		std::list<SignCondition> signs;
+		std::list<Polynomial> products;
+		std::list<Alpha> ada;
+		std::list<uint> adaHelper;
+		Eigen::MatrixXf matrix;
+	};
+	
 	std::list<Polynomial> mP;
 	TarskiQueryManager<Number> mTaQ;
 	std::list<SignCondition> mSigns;
@@ -38,7 +48,11 @@ private:
 	std::list<Alpha> mAda;
 	std::list<uint> mAdaHelper;
 	Eigen::MatrixXf mMatrix;
+	// decomposition of mMatrix, reused for every query until the next update
+	Eigen::PartialPivLU<Eigen::MatrixXf> mMatrixDecomposition;
 	bool mNeedsUpdate;
+	// results of getSigns for the current state, invalidated whenever a polynomial is added
+	std::map<Polynomial, CachedResult> mCache;
 	
 	
 	
@@ -52,7 +66,9 @@ public:
 		mAda(),
 		mAdaHelper(),
 		mMatrix(),
-		mNeedsUpdate(false)
+		mMatrixDecomposition(),
+		mNeedsUpdate(false),
+		mCache()
 	{}
 
 	
@@ -67,7 +83,9 @@ public:
 		mAda(other.mAda),
 		mAdaHelper(other.mAdaHelper),
 		mMatrix(other.mMatrix),
-		mNeedsUpdate(other.mNeedsUpdate)
+		mMatrixDecomposition(other.mMatrixDecomposition),
+		mNeedsUpdate(other.mNeedsUpdate),
+		mCache(other.mCache)
 	{}
 	
 	uint sizeOfZeroSet() const {
@@ -117,14 +135,29 @@ private:
 		}
 		return res;
 	} 
-	static Eigen::MatrixXf kroneckerProduct(const Eigen::MatrixXf& m1, const Eigen::MatrixXf& m2) {
-		Eigen::MatrixXf m3(m1.rows() * m2.rows(), m1.cols() * m2.cols());
-		for(int i = 0; i < m1.cols(); i++) {
-			for(int j = 0; j < m1.rows(); j++) {
-				m3.block(i * m2.rows(), j * m2.cols(), m2.rows(), m2.cols()) =  m1(i, j) * m2;
-			}
+	/*
+	 * Solves (m1 (x) m2) * c = d without building the kronecker product.
+	 * Writing c and d row-wise as matrices C and D this is m1 * C * m2^T = D,
+	 * hence only m1 has to be decomposed, m2 is given by its (cached) decomposition.
+	 */
+	static Eigen::VectorXf solveKronecker(
+			const Eigen::MatrixXf& m1,
+			const Eigen::PartialPivLU<Eigen::MatrixXf>& m2Decomposition,
+			const Eigen::VectorXf& d) {
+		long n1 = m1.rows();
+		long n2 = m2Decomposition.rows();
+		CARL_LOG_ASSERT("carl.thom.sign", d.size() == n1 * n2, "dimension mismatch");
+		Eigen::MatrixXf D(n1, n2);
+		for(long i = 0; i < n1; i++) {
+			for(long k = 0; k < n2; k++) D(i, k) = d(i * n2 + k);
 		}
-		return m3;
+		Eigen::MatrixXf X = m1.partialPivLu().solve(D);
+		Eigen::MatrixXf Ct = m2Decomposition.solve(Eigen::MatrixXf(X.transpose()));
+		Eigen::VectorXf c(n1 * n2);
+		for(long j = 0; j < n1; j++) {
+			for(long l = 0; l < n2; l++) c(j * n2 + l) = Ct(l, j);
+		}
+		return c;
 	}
 	static void removeColumn(Eigen::MatrixXf& matrix, long colToRemove) {
 		long numRows = matrix.rows();
@@ -278,6 +311,7 @@ private:
 		mAda = newAda;
 		mMatrix = adaptedMat(mAda, mSigns);
 		CARL_LOG_ASSERT("carl.thom.sign", Eigen::FullPivLU<Eigen::MatrixXf>(mMatrix).rank() == mMatrix.cols(), "mMatrix must be invertible!");
+		mMatrixDecomposition.compute(mMatrix);
 		mProducts = adaptedProducts;
 		mNeedsUpdate = false;
 		CARL_LOG_DEBUG("carl.thom.sign", *this);
@@ -292,6 +326,27 @@ private:
 	) {
 		if(mNeedsUpdate) this->update();
 		
+		auto cached = mCache.find(p);
+		if(cached != mCache.end()) {
+			CARL_LOG_TRACE("carl.thom.sign", "reusing cached result for " << p);
+			products = cached->second.products;
+			ada = cached->second.ada;
+			adaHelper = cached->second.adaHelper;
+			matrix = cached->second.matrix;
+			return cached->second.signs;
+		}
+		std::list<SignCondition> result = computeSigns(p, products, ada, adaHelper, matrix);
+		mCache.emplace(p, CachedResult{result, products, ada, adaHelper, matrix});
+		return result;
+	}
+	
+	std::list<SignCondition> computeSigns (
+			const Polynomial& p,
+			std::list<Polynomial>& products,
+			std::list<Alpha>& ada,
+			std::list<uint>& adaHelper,
+			Eigen::MatrixXf& matrix
+	) const {
 		CARL_LOG_TRACE("carl.thom.sign", "processing " << p);
 		std::list<Polynomial> currProducts;
 		TaQResType taq0 = mTaQ(Number(1));
@@ -327,24 +382,19 @@ private:
 			products = currProducts;
 			ada = currAda;
 			matrix = currM;
-			mNeedsUpdate = false;
 			return currSigns;
 		}
 		
 		// (2)
 		products = this->computeProducts(p, currAda);
 		
-		Eigen::VectorXf dprime(long(products.size()));
-		long index = 0;
-		for (const auto& prod : products) {
-			dprime(index) = float(mTaQ(prod));
-			index++;
+		std::vector<TaQResType> queries = mTaQ(products.begin(), products.end());
+		Eigen::VectorXf dprime(long(queries.size()));
+		for (long index = 0; index < long(queries.size()); index++) {
+			dprime(index) = float(queries[std::size_t(index)]);
 		}
 		
-		Eigen::MatrixXf M_prime = kroneckerProduct(currM, mMatrix);
-		CARL_LOG_ASSERT("carl.thom.sign", Eigen::FullPivLU<Eigen::MatrixXf>(M_prime).rank() == M_prime.cols(), "M_prime must be invertible!");
-		Eigen::PartialPivLU<Eigen::MatrixXf> dec(M_prime);
-		Eigen::VectorXf c = dec.solve(dprime);
+		Eigen::VectorXf c = solveKronecker(currM, mMatrixDecomposition, dprime);
 		CARL_LOG_ASSERT("carl.thom.sign", (uint)c.size() == currSigns.size() * mSigns.size(), "failure in sign determination");
 		
 		std::list<SignCondition> newSigns;
@@ -397,8 +447,10 @@ public:
 		if(mP.empty()) {
 			mAda = newAda;
 			mMatrix = newMatrix;
+			mMatrixDecomposition.compute(mMatrix);
 			mNeedsUpdate = false;
 		}
+		mCache.clear();
 		mP.push_front(p);
 		mSigns = newSigns;
 		mProducts = newProducts;
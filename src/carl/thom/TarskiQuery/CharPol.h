@@ -79,10 +79,11 @@ std::vector<Coeff> charPol(const CoeffMatrix<Coeff>& m) {
 		//printMatrix(C.back());
 	}
 	
+	// tr(B_i * C_j) only needs the diagonal of the product, i.e. O(n^2) instead of O(n^3)
 	for(std::size_t i = 1; i < r; i++) {
 		for(std::size_t j = 1; j < r; j++) {
-			CoeffMatrix<Coeff> tmp(B[i] * C[j-1]);
-			N[j*r + i] = tmp.trace();
+			if(j*r + i > std::size_t(n)) continue;
+			N[j*r + i] = B[i].cwiseProduct(C[j-1].transpose()).sum();
 		}
 	}
 	N.resize(std::size_t(n) + 1);
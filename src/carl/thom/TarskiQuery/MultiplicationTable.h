@@ -74,13 +74,30 @@ private:
 	// the groebner base object is used to compute reductions
 	GroebnerBase<Number> mGb;
 	
+	/*
+	 * the table in compressed sparse row format: row r holds the base representation of the
+	 * r-th (nonzero) product monomial in the columns mColumns[mRowOffsets[r]] ... mColumns[mRowOffsets[r+1]-1]
+	 * and mRowPairs[r] holds all pairs of basis indices whose product is this monomial.
+	 */
+	std::vector<std::size_t> mRowOffsets;
+	std::vector<uint> mColumns;
+	std::vector<Number> mValues;
+	std::vector<std::vector<std::pair<uint, uint>>> mRowPairs;
+	
+	// the traces of the multiplication maps of the basis elements, trace is linear and thus given by these
+	std::vector<Number> mTraces;
+	
+	// the trace form Tr(b_i * b_j) as a dense row-major matrix
+	std::vector<Number> mTraceForm;
+	
 public:
 	
-	MultiplicationTable() : mTable(), mBase(), mGb() {}
+	MultiplicationTable() : mTable(), mBase(), mGb(), mRowOffsets(1, 0), mColumns(), mValues(), mRowPairs(), mTraces(), mTraceForm() {}
 	
-	explicit MultiplicationTable(const GroebnerBase<Number>& gb) : mGb(gb){
+	explicit MultiplicationTable(const GroebnerBase<Number>& gb) : mGb(gb), mRowOffsets(1, 0) {
 		CARL_LOG_ASSERT("carl.thom.tarski.table", gb.hasFiniteMon(), "tried to set up a multiplication table on infinite basis");
 		init(gb);
+		initSparse();
 		CARL_LOG_TRACE("carl.thom.tarski.table", "done setting up multiplication table:\n" << *this);
 	}
 	
@@ -137,11 +154,47 @@ public:
 	Number trace(const BaseRepresentation<Number>& f) const {
 		Number res(0);
 		for(const auto& index_coeff : f) {
-			for(uint i = 0; i < mBase.size(); i++) {
-				Monomial prod = mBase[index_coeff.first] * mBase[i];
-				BaseRepresentation<Number> prod_br = this->getEntry(prod).br;
-				res += index_coeff.second * prod_br.get(i);
-			}		   
+			res += index_coeff.second * mTraces[index_coeff.first];
+		}
+		return res;
+	}
+	
+	/*
+	 * number of rows of the sparse table, i.e. the number of product monomials with nonzero normal form
+	 */
+	std::size_t rows() const noexcept {
+		return mRowPairs.size();
+	}
+	
+	const std::vector<std::pair<uint, uint>>& rowPairs(std::size_t row) const {
+		assert(row < mRowPairs.size());
+		return mRowPairs[row];
+	}
+	
+	/*
+	 * sparse dot product of the given row with the dense vector x
+	 */
+	Number rowTimes(std::size_t row, const std::vector<Number>& x) const {
+		assert(row + 1 < mRowOffsets.size());
+		assert(x.size() == mBase.size());
+		Number res(0);
+		for(std::size_t k = mRowOffsets[row]; k < mRowOffsets[row + 1]; k++) {
+			res += mValues[k] * x[mColumns[k]];
+		}
+		return res;
+	}
+	
+	/*
+	 * computes the vector (Tr(f * b_0), ..., Tr(f * b_n-1)) in time O(|f| * n) using the trace form
+	 */
+	std::vector<Number> traceForm(const BaseRepresentation<Number>& f) const {
+		std::size_t n = mBase.size();
+		std::vector<Number> res(n, Number(0));
+		for(const auto& index_coeff : f) {
+			const Number* row = mTraceForm.data() + index_coeff.first * n;
+			for(std::size_t l = 0; l < n; l++) {
+				if(row[l] != 0) res[l] += index_coeff.second * row[l];
+			}
 		}
 		return res;
 	}
@@ -151,20 +204,60 @@ public:
 	
 private:
 	
-	// returns a list of all pairs of indicdes (i,j) such that base_i * base_j == c
-	IndexPairs indexPairs(const Monomial& c) const {
-		IndexPairs res;
+	// maps every product base_i * base_j to the list of all pairs of indices (i,j) yielding it
+	std::unordered_map<Monomial, IndexPairs> allIndexPairs() const {
+		std::unordered_map<Monomial, IndexPairs> res;
 		for(uint i = 0; i < mBase.size(); i++) {
 			for(uint j = i; j < mBase.size(); j++) {
-				if(mBase[i] * mBase[j] == c) {
-					res.push_front(std::make_pair(i, j));
-					if(i != j) res.push_front(std::make_pair(j, i));
-				}
+				IndexPairs& pairs = res[mBase[i] * mBase[j]];
+				pairs.push_front(std::make_pair(i, j));
+				if(i != j) pairs.push_front(std::make_pair(j, i));
 			}
 		}
 		return res;
 	}
 	
+	void initSparse() {
+		std::size_t n = mBase.size();
+		mRowOffsets.assign(1, 0);
+		mColumns.clear();
+		mValues.clear();
+		mRowPairs.clear();
+		for(const auto& entry : mTable) {
+			if(entry.second.br.isZero() || entry.second.pairs.empty()) continue;
+			// std::map iterates the columns in increasing order
+			for(const auto& index_coeff : entry.second.br) {
+				mColumns.push_back(index_coeff.first);
+				mValues.push_back(index_coeff.second);
+			}
+			mRowOffsets.push_back(mColumns.size());
+			mRowPairs.emplace_back(entry.second.pairs.begin(), entry.second.pairs.end());
+		}
+		
+		// Tr(b_i) is the sum of the coefficients of b_k in the normal forms of b_i * b_k
+		mTraces.assign(n, Number(0));
+		for(std::size_t r = 0; r < rows(); r++) {
+			for(const auto& pair : mRowPairs[r]) {
+				for(std::size_t k = mRowOffsets[r]; k < mRowOffsets[r + 1]; k++) {
+					if(mColumns[k] == pair.second) {
+						mTraces[pair.first] += mValues[k];
+						break;
+					}
+				}
+			}
+		}
+		
+		// Tr(b_i * b_j) is the trace of the normal form of b_i * b_j
+		mTraceForm.assign(n * n, Number(0));
+		for(std::size_t r = 0; r < rows(); r++) {
+			Number t = rowTimes(r, mTraces);
+			for(const auto& pair : mRowPairs[r]) {
+				mTraceForm[pair.first * n + pair.second] = t;
+			}
+		}
+		CARL_LOG_INFO("carl.thom.tarski.table", "sparse table has " << rows() << " rows and " << mValues.size() << " nonzero entries");
+	}
+	
 	void init(const GroebnerBase<Number>& gb) {
 		CARL_LOG_FUNC("carl.thom.tarski", "gb = " << gb.get());
 		
@@ -178,6 +271,14 @@ private:
 		std::sort(Mon.begin(), Mon.end());
 		mBase = Mon;
 		
+		// all pairs of basis elements, grouped by their product
+		std::unordered_map<Monomial, IndexPairs> pairsOf = allIndexPairs();
+		auto indexPairs = [&pairsOf](const Monomial& c) {
+			auto it = pairsOf.find(c);
+			if(it == pairsOf.end()) return IndexPairs();
+			return it->second;
+		};
+		
 		// monomials in bor in increasing order
 		std::sort(Bor.begin(), Bor.end());
 		
@@ -264,15 +365,10 @@ private:
 		// ---- step 3 ----
 		// find the normal forms of all other elements in Tab(Mon)
 		// Tab(Mon) = set of products of elements from Mon
-		std::list<Monomial> tabmon;
-		for(const auto& m1 : Mon) {
-			for(const auto& m2 : Mon) {
-				Monomial prod = m1 * m2;
-				if(std::find(tabmon.begin(), tabmon.end(), prod) == tabmon.end()) {
-					tabmon.push_back(prod);
-				}				
-			}
-		}
+		std::vector<Monomial> tabmon;
+		tabmon.reserve(pairsOf.size());
+		for(const auto& entry : pairsOf) tabmon.push_back(entry.first);
+		std::sort(tabmon.begin(), tabmon.end());
 		CARL_LOG_TRACE("carl.thom.tarski", "tabmon = " << tabmon);
 		for(const auto& m : tabmon) {
 			if(!this->contains(m)) {
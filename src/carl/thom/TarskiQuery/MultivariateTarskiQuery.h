@@ -18,41 +18,21 @@ template<typename Number>
 int multivariateTarskiQuery(const MultivariatePolynomial<Number>& Q, const MultiplicationTable<Number>& table) {
         CARL_LOG_FUNC("carl.thom.tarski", "Q = " << Q);
         BaseRepresentation<Number> q = table.reduce(Q);
-        std::vector<typename MultiplicationTable<Number>::Monomial> base = table.getBase();
-        // compute the traces...
-        CoeffMatrix<Number> m(base.size(), base.size());
-        CARL_LOG_INFO("carl.thom.tarski", "base size is " << base.size());
+        std::size_t n = table.getBase().size();
+        // the entries of the hermite matrix are Tr(Q * b_i * b_j) = <NF(b_i * b_j), u>
+        // with u = (Tr(Q * b_0), ..., Tr(Q * b_n-1)), thus one sparse matrix vector product suffices
+        CoeffMatrix<Number> m = CoeffMatrix<Number>::Zero(long(n), long(n));
+        CARL_LOG_INFO("carl.thom.tarski", "base size is " << n);
         CARL_LOG_INFO("carl.thom.tarski", "setting up the matrix now ...");
-        for(const auto& entry : table) {
-                BaseRepresentation<Number> Qc = table.multiply(q, entry.second.br);
-                Number t = table.trace(Qc);
-                for (const auto& pair : entry.second.pairs) {
+        std::vector<Number> u = table.traceForm(q);
+        for(std::size_t row = 0; row < table.rows(); row++) {
+                Number t = table.rowTimes(row, u);
+                if(t == 0) continue;
+                for(const auto& pair : table.rowPairs(row)) {
                         m(long(pair.first), long(pair.second)) = t;
                 }
         }
         
-        /*
-        for(uint i = 0; i < base.size(); i++) {
-                for(uint j = i; j < base.size(); j++) {    
-                        BaseRepresentation<Number> prod = table.getEntry(base[i] * base[j]).br;
-                        BaseRepresentation<Number> Qc = table.multiply(q, prod);
-                        //BaseRepresentation<Number> Qc = table.reduce(base[i] * base[j] * Q);
-                        Number t = table.trace(Qc);
-                        m(i, j) = t;
-                        m(j, i) = t;
-                }
-        }
-        */
-        /*
-        for(uint i = 0; i < base.size(); i++) {
-                for(uint j = i; j < base.size(); j++) {
-                        std::cout << m(i, j) << "\t\t";
-                }
-                std::cout << std::endl;
-        }
-        std::cout << std::endl;
-        */
-        
         CARL_LOG_INFO("carl.thom.tarski", "... done setting up matrix.");
         std::vector<Number> cp = charPol(m);
         CARL_LOG_TRACE("carl.thom.tarski", "char pol: " << cp);
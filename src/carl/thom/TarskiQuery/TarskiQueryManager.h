@@ -8,6 +8,7 @@
 #pragma once
 
 #include <iterator>
+#include <vector>
 
 #include "MultiplicationTable.h"
 #include "MultivariateTarskiQuery.h"
@@ -91,7 +92,10 @@ public:
                         else pUniv = p.toUnivariatePolynomial();
                         CARL_LOG_ASSERT("carl.thom.tarski.manager", pUniv.mainVar() == mZ.mainVar(),
                                 "cannot compute tarski query of " << p << " on " << mZ);
-                        res = univariateTarskiQuery(pUniv, mZ, mDer);
+                        // only the values on the zero set matter, hence we can reduce modulo mZ
+                        if(!pUniv.isZero() && pUniv.degree() >= mZ.degree()) pUniv = pUniv.remainder(mZ);
+                        if(pUniv.isZero()) res = 0;
+                        else res = univariateTarskiQuery(pUniv, mZ, mDer);
                 }
                 
                 // multivariate manager
@@ -111,10 +115,40 @@ public:
                 return (*this)(Polynomial(c));
         }
         
+        /*
+         * computes the tarski queries of all polynomials in [first, last) on the same zero set.
+         * the polynomials are reduced first, such that polynomials that agree on the zero set share
+         * a single cache entry and every distinct query is computed only once.
+         */
+        template<typename InputIt>
+        std::vector<QueryResultType> operator()(InputIt first, InputIt last) const {
+                std::vector<QueryResultType> res;
+                res.reserve(std::size_t(std::distance(first, last)));
+                for(; first != last; first++) {
+                        res.push_back((*this)(reduce(*first)));
+                }
+                return res;
+        }
+        
+        /*
+         * returns a polynomial that agrees with p on the zero set and is reduced with respect to it
+         */
+        Polynomial reduce(const Polynomial& p) const {
+                if(p.isConstant()) return p;
+                if(this->isUnivariateManager()) {
+                        UnivariatePolynomial<Number> pUniv = p.toUnivariatePolynomial();
+                        if(pUniv.degree() < mZ.degree()) return p;
+                        UnivariatePolynomial<Number> rem = pUniv.remainder(mZ);
+                        if(rem.isZero()) return Polynomial(Number(0));
+                        return Polynomial(rem);
+                }
+                if(mTrivialGb) return p;
+                return mTab.baseReprToPolynomial(mTab.reduce(p));
+        }
+        
         Polynomial reduceProduct(const Polynomial& a, const Polynomial& b) const {
                 if(this->isUnivariateManager()) {
-                        // todo: implement
-                        return a * b;
+                        return reduce(a * b);
                 }
                 else {
                         return mTab.baseReprToPolynomial(mTab.reduce(a * b));
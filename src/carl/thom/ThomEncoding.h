@@ -93,7 +93,7 @@ public:
 	inline Variable::Arg mainVar() const { return mMainVar; }
 	inline const Polynomial& polynomial() const { return mP; } 
 	inline const ThomEncoding<Number>& point() const {assert(mPoint); return *mPoint; }
-	inline SignDetermination<Number> sd() const {assert(mSd); return *mSd; }
+	inline const SignDetermination<Number>& sd() const {assert(mSd); return *mSd; }
 	
 	std::list<Polynomial> relevantDerivatives() const {
 		std::list<Polynomial> derivatives = der(mP, mMainVar, 0, mP.degree(mMainVar));
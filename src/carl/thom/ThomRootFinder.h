@@ -8,10 +8,15 @@
 #pragma once
 
 #include "../interval/Interval.h"
+#include "SignDetermination/SignDetermination.h"
 #include "ThomEncoding.h"
 #include "ThomUtil.h"
 #include "../formula/model/ran/RealAlgebraicNumber.h"
 
+#include <algorithm>
+#include <limits>
+#include <vector>
+
 namespace carl {
         
 // forward declarations
@@ -111,52 +116,181 @@ std::list<ThomEncoding<Number>> realRootsThom(
 }
 
 /*
- * don't call this directly
+ * Heap-ordered root queue: returns the real roots of p (lifted over the point, if given) inside the
+ * interval in ascending order.
+ * 
+ * This is not a lazy root isolation: the constructor runs the sign determination and builds the Thom
+ * encodings of all real roots of p up front, also of those outside the interval. The sign conditions
+ * are not restricted to the roots inside the interval, as a Thom encoding only identifies its root if
+ * the derivative signs distinguish it from all other roots of p.
+ * Only the ordering is deferred, i.e. the encodings are kept in a heap such that the k smallest roots
+ * are available after O(n + k log n) comparisons instead of sorting all of them. Taking roots stops at
+ * the first root above the upper bound and then releases the remaining encodings together with their
+ * sign determination object.
+ * In the univariate case the number of roots inside a bounded interval is computed by Tarski queries
+ * before the sign determination, which is skipped entirely if there is no root inside the interval.
  */
 template<typename Number>
-std::list<ThomEncoding<Number>> realRootsThom(
-                const MultivariatePolynomial<Number>& p,
-                Variable::Arg mainVar,
-		std::shared_ptr<ThomEncoding<Number>> point_ptr,
-		const Interval<Number>& interval
-) {
+class ThomRootQueue {
+        
         using Polynomial = MultivariatePolynomial<Number>;
-        std::list<ThomEncoding<Number>> result;
         
+        Interval<Number> mInterval;
+        std::vector<ThomEncoding<Number>> mHeap;
+        // number of roots inside the interval which have not been enumerated yet (only known in the univariate case)
+        std::size_t mRemaining;
+        bool mRemainingKnown;
+        // the roots are returned regardless of the interval (p vanishes on the point)
+        bool mIgnoreBounds;
+        bool mDone;
         
+        static bool heapCompare(const ThomEncoding<Number>& lhs, const ThomEncoding<Number>& rhs) {
+                return lhs > rhs;
+        }
         
-        if(point_ptr == nullptr) {
-                std::list<Polynomial> derivatives = der(p, mainVar, 1, p.degree(mainVar));
-                
+public:
+        
+        ThomRootQueue(
+                        const Polynomial& p,
+                        Variable::Arg mainVar,
+                        std::shared_ptr<ThomEncoding<Number>> point_ptr,
+                        const Interval<Number>& interval = Interval<Number>::unboundedInterval()
+        ):
+                mInterval(interval),
+                mHeap(),
+                mRemaining(0),
+                mRemainingKnown(false),
+                mIgnoreBounds(false),
+                mDone(false)
+        {
+                if(point_ptr == nullptr) initUnivariate(p, mainVar);
+                else initOverPoint(p, mainVar, point_ptr);
+                std::make_heap(mHeap.begin(), mHeap.end(), &heapCompare);
+                if(mHeap.empty()) finish();
+        }
+        
+        /*
+         * checks whether there is another root inside the interval.
+         * roots below the lower bound are dropped on the way.
+         */
+        bool hasNext() {
+                if(mDone) return false;
+                while(!mHeap.empty()) {
+                        if(mIgnoreBounds) return true;
+                        if(mRemainingKnown && mRemaining == 0) break;
+                        const ThomEncoding<Number>& min = mHeap.front();
+                        if(belowLowerBound(min)) {
+                                std::pop_heap(mHeap.begin(), mHeap.end(), &heapCompare);
+                                mHeap.pop_back();
+                                continue;
+                        }
+                        if(aboveUpperBound(min)) break;
+                        return true;
+                }
+                finish();
+                return false;
+        }
+        
+        /*
+         * returns the smallest root inside the interval that has not been returned yet
+         */
+        ThomEncoding<Number> next() {
+                bool hasNextRoot = hasNext();
+                CARL_LOG_ASSERT("carl.thom.rootfinder", hasNextRoot, "there is no further root");
+                (void)hasNextRoot;
+                std::pop_heap(mHeap.begin(), mHeap.end(), &heapCompare);
+                ThomEncoding<Number> res = std::move(mHeap.back());
+                mHeap.pop_back();
+                if(mRemainingKnown) mRemaining--;
+                return res;
+        }
+        
+        /*
+         * returns the (at most) k smallest roots inside the interval that have not been returned yet
+         */
+        std::list<ThomEncoding<Number>> take(std::size_t k) {
+                std::list<ThomEncoding<Number>> res;
+                while(res.size() < k && hasNext()) res.push_back(next());
+                return res;
+        }
+        
+        std::list<ThomEncoding<Number>> all() {
+                return take(std::numeric_limits<std::size_t>::max());
+        }
+        
+private:
+        
+        void finish() {
+                mHeap.clear();
+                mHeap.shrink_to_fit();
+                mDone = true;
+        }
+        
+        bool belowLowerBound(const ThomEncoding<Number>& te) const {
+                switch(mInterval.lowerBoundType()) {
+                        case BoundType::STRICT: return te <= mInterval.lower();
+                        case BoundType::WEAK: return te < mInterval.lower();
+                        default: return false;
+                }
+        }
+        
+        bool aboveUpperBound(const ThomEncoding<Number>& te) const {
+                switch(mInterval.upperBoundType()) {
+                        case BoundType::STRICT: return te >= mInterval.upper();
+                        case BoundType::WEAK: return te > mInterval.upper();
+                        default: return false;
+                }
+        }
+        
+        /*
+         * number of roots of p inside the interval, computed via tarski queries on the zero set of p
+         */
+        std::size_t rootsInInterval(const Polynomial& p, Variable::Arg mainVar, const TarskiQueryManager<Number>& taq) const {
+                Polynomial q(Number(1));
+                if(mInterval.lowerBoundType() != BoundType::INFTY) q *= Polynomial(mainVar) - mInterval.lower();
+                if(mInterval.upperBoundType() != BoundType::INFTY) q *= Polynomial(mInterval.upper()) - Polynomial(mainVar);
+                // roots where q is positive, i.e. in the interior of the interval
+                auto res = std::size_t((taq(q) + taq(q * q)) / 2);
+                UnivariatePolynomial<Number> pUniv = p.toUnivariatePolynomial();
+                if(mInterval.lowerBoundType() == BoundType::WEAK && pUniv.isRoot(mInterval.lower())) res++;
+                if(mInterval.upperBoundType() == BoundType::WEAK && pUniv.isRoot(mInterval.upper()) && mInterval.lower() != mInterval.upper()) res++;
+                return res;
+        }
+        
+        void initUnivariate(const Polynomial& p, Variable::Arg mainVar) {
                 std::vector<Polynomial> zeroSet = {p};
-                SignDetermination<Number> sd(zeroSet.begin(), zeroSet.end());
+                if(!mInterval.isInfinite()) {
+                        TarskiQueryManager<Number> taq(zeroSet.begin(), zeroSet.end());
+                        mRemaining = rootsInInterval(p, mainVar, taq);
+                        mRemainingKnown = true;
+                        CARL_LOG_TRACE("carl.thom.rootfinder", mRemaining << " roots in " << mInterval);
+                        if(mRemaining == 0) return;
+                }
                 
+                SignDetermination<Number> sd(zeroSet.begin(), zeroSet.end());
                 uint numOfRoots = sd.sizeOfZeroSet();
-                if(numOfRoots == 0) return {};
+                if(numOfRoots == 0) return;
                 
+                std::list<Polynomial> derivatives = der(p, mainVar, 1, p.degree(mainVar));
                 std::list<SignCondition> signs = {};
                 auto it = derivatives.rbegin();
                 while(signs.size() < numOfRoots) {
                         signs = sd.getSignsAndAdd(*it);
                         it++;
                 }
-                std::shared_ptr<SignDetermination<Number>> sd_ptr = std::make_shared<SignDetermination<Number>>(sd);
+                std::shared_ptr<SignDetermination<Number>> sd_ptr = std::make_shared<SignDetermination<Number>>(std::move(sd));
+                mHeap.reserve(signs.size());
                 for(const auto& sigma : signs) {
-                        ThomEncoding<Number> newEncoding(
-                                sigma,
-                                p,
-                                mainVar,
-                                nullptr,
-                                sd_ptr,
-                                sigma.size());
-                        result.push_back(newEncoding);
+                        mHeap.emplace_back(sigma, p, mainVar, nullptr, sd_ptr, sigma.size());
                 }
-            
         }
-        else {
+        
+        void initOverPoint(const Polynomial& p, Variable::Arg mainVar, const std::shared_ptr<ThomEncoding<Number>>& point_ptr) {
                 // check if p vanishes on point
                 if(point_ptr->makesPolynomialZero(p, mainVar)) {
-                        return {ThomEncoding<Number>(Number(0), mainVar)};
+                        mHeap.emplace_back(Number(0), mainVar);
+                        mIgnoreBounds = true;
+                        return;
                 }
                 
                 std::list<Polynomial> zeroSet = point_ptr->accumulatePolynomials();
@@ -164,9 +298,9 @@ std::list<ThomEncoding<Number>> realRootsThom(
 
                 SignDetermination<Number> sd(zeroSet.begin(), zeroSet.end());
                 uint numOfRoots = sd.sizeOfZeroSet();
-                if(numOfRoots == 0) return {};
+                if(numOfRoots == 0) return;
                 
-                std::list<Polynomial> pointDerivatives = point_ptr->sd().processedPolynomials();
+                const std::list<Polynomial>& pointDerivatives = point_ptr->sd().processedPolynomials();
                 sd.getSignsAndAddAll(pointDerivatives.rbegin(), pointDerivatives.rend());
                 
                 std::list<Polynomial> pDerivatives = der(p, mainVar, 1, p.degree(mainVar));
@@ -180,63 +314,31 @@ std::list<ThomEncoding<Number>> realRootsThom(
                         relevant++;
                 }
                 
-                std::shared_ptr<SignDetermination<Number>> sd_ptr = std::make_shared<SignDetermination<Number>>(sd);
+                std::shared_ptr<SignDetermination<Number>> sd_ptr = std::make_shared<SignDetermination<Number>>(std::move(sd));
                 SignCondition pointSigns = point_ptr->accumulateRelevantSigns();
                 for(const auto& sigma : signs) {
                         CARL_LOG_ASSERT("carl.thom.rootfinder", sigma.size() == pointSigns.size() + relevant, "");
                         if(pointSigns.isSuffixOf(sigma)) {
                                 SignCondition newSigma(sigma);
                                 newSigma.resize(relevant);
-                                ThomEncoding<Number> newEncoding(
-                                        newSigma,
-                                        p,
-                                        mainVar,
-                                        point_ptr,
-                                        sd_ptr,
-                                        relevant
-                                );
-                                result.push_back(newEncoding);
+                                mHeap.emplace_back(newSigma, p, mainVar, point_ptr, sd_ptr, relevant);
                         }
                 }
         }
-        
-        // convert in a vector because std::sort needs random access iterator
-        std::vector<ThomEncoding<Number>> result_vec(result.begin(), result.end());
-        std::sort(result_vec.begin(), result_vec.end());
-        result = std::list<ThomEncoding<Number>>(result_vec.begin(), result_vec.end());
-        
-        // check bounds
-        // this could be optimized e.g. using binary search ...
-        if(interval.lowerBoundType() == BoundType::STRICT) {
-                auto it = result.begin();
-                while(it != result.end() && *it <= interval.lower()) {
-                        it = result.erase(it);
-                }
-        }
-        else if(interval.lowerBoundType() == BoundType::WEAK) {
-                auto it = result.begin();
-                while(it != result.end() && *it < interval.lower()) {
-                        it = result.erase(it);
-                }
-        }
-        
-        if(interval.upperBoundType() == BoundType::STRICT) {
-                std::reverse(result.begin(), result.end());
-                auto it = result.begin();
-                while(it != result.end() && *it >= interval.upper()) {
-                        it = result.erase(it);;
-                }
-                std::reverse(result.begin(), result.end());
-        }
-        else if(interval.upperBoundType() == BoundType::WEAK) {
-                std::reverse(result.begin(), result.end());
-                auto it = result.begin();
-                while(it != result.end() && *it > interval.upper()) {
-                        it = result.erase(it);
-                }
-                std::reverse(result.begin(), result.end());
-        }
-        
+};
+
+/*
+ * don't call this directly
+ */
+template<typename Number>
+std::list<ThomEncoding<Number>> realRootsThom(
+                const MultivariatePolynomial<Number>& p,
+                Variable::Arg mainVar,
+		std::shared_ptr<ThomEncoding<Number>> point_ptr,
+		const Interval<Number>& interval
+) {
+        ThomRootQueue<Number> roots(p, mainVar, std::move(point_ptr), interval);
+        std::list<ThomEncoding<Number>> result = roots.all();
         CARL_LOG_INFO("carl.thom.rootfinder", "found the following roots: " << result);
         return result;
 }
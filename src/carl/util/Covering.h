@@ -1,7 +1,18 @@
 #pragma once
 
+#include <iostream>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "Bitset.h"
+
 namespace carl {
 
+/**
+ * Represents a set cover problem: a number of elements (intervals) and a family of sets, each given by a key and a Bitset of the elements it covers.
+ * A conflicting core is a subfamily of sets covering all elements that are covered at all.
+ */
 template<typename T>
 class Covering {
 	template<typename TT>
@@ -9,6 +20,37 @@ class Covering {
 private:
 	std::map<T, carl::Bitset> mData;
 	carl::Bitset mOkay;
+
+	/**
+	 * Returns all elements that are covered by some set.
+	 */
+	carl::Bitset coverable() const {
+		carl::Bitset res;
+		res.resize(mOkay.size(), false);
+		for (const auto& d: mData) res |= d.second;
+		return res;
+	}
+	/**
+	 * Searches for a cover of uncovered with less sets than best, extending chosen.
+	 */
+	void search(const std::vector<std::pair<T, carl::Bitset>>& sets, const carl::Bitset& uncovered, std::vector<T>& chosen, std::vector<T>& best) const {
+		if (uncovered.none()) {
+			best = chosen;
+			return;
+		}
+		// at least one more set is needed
+		if (chosen.size() + 1 >= best.size()) return;
+		// some set has to cover the first uncovered element
+		std::size_t element = uncovered.find_first();
+		for (const auto& s: sets) {
+			if (!s.second.test(element)) continue;
+			carl::Bitset rest = uncovered;
+			rest -= s.second;
+			chosen.push_back(s.first);
+			search(sets, rest, chosen, best);
+			chosen.pop_back();
+		}
+	}
 public:
 	Covering(std::size_t intervals) {
 		mOkay.resize(intervals, true);
@@ -23,10 +65,13 @@ public:
 	std::size_t satisfyingInterval() const {
 		return mOkay.find_first();
 	}
+	/**
+	 * Builds a conflicting core greedily, always choosing the set that covers the most elements that are not covered yet.
+	 * @param core Receives the conflicting core.
+	 */
 	void buildConflictingCore(std::vector<T>& core) const {
 		std::map<T, carl::Bitset> data = mData;
-		carl::Bitset covered;
-		covered.resize(mOkay.size(), true);
+		carl::Bitset covered = coverable();
 		while (covered.any()) {
 			auto maxit = data.begin();
 			for (auto it = data.begin(); it != data.end(); it++) {
@@ -40,6 +85,19 @@ public:
 			}
 		}
 	}
+	/**
+	 * Builds a conflicting core of minimal size by a branch and bound search that uses the greedy core as initial bound.
+	 * The search is exponential in the number of sets and should only be used for small instances.
+	 * @param core Receives the conflicting core.
+	 */
+	void buildMinimalConflictingCore(std::vector<T>& core) const {
+		std::vector<T> best;
+		buildConflictingCore(best);
+		std::vector<std::pair<T, carl::Bitset>> sets(mData.begin(), mData.end());
+		std::vector<T> chosen;
+		search(sets, coverable(), chosen, best);
+		core.insert(core.end(), best.begin(), best.end());
+	}
 };
 template<typename TT>
 std::ostream& operator<<(std::ostream& os, const Covering<TT>& ri) {
@@ -0,0 +1,129 @@
+/**
+ * @file ThreadPool.h
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace carl {
+
+/**
+ * A simple pool of worker threads executing submitted tasks in FIFO order.
+ *
+ * Note that most of the polynomial arithmetic relies on global pools that are only protected if carl was built with THREAD_SAFE.
+ * A pool with zero threads is valid and executes all tasks synchronously within the calling thread.
+ */
+class ThreadPool {
+private:
+	/// Worker threads.
+	std::vector<std::thread> mWorkers;
+	/// Tasks not yet started.
+	std::queue<std::function<void()>> mTasks;
+	std::mutex mMutex;
+	std::condition_variable mCondition;
+	bool mStop;
+
+	void work() {
+		while (true) {
+			std::function<void()> task;
+			{
+				std::unique_lock<std::mutex> lock(mMutex);
+				mCondition.wait(lock, [this](){ return mStop || !mTasks.empty(); });
+				if (mStop && mTasks.empty()) return;
+				task = std::move(mTasks.front());
+				mTasks.pop();
+			}
+			task();
+		}
+	}
+public:
+	/**
+	 * Creates a pool with the given number of worker threads.
+	 * @param threads Number of worker threads.
+	 */
+	explicit ThreadPool(std::size_t threads): mWorkers(), mTasks(), mMutex(), mCondition(), mStop(false) {
+		mWorkers.reserve(threads);
+		for (std::size_t i = 0; i < threads; i++) {
+			mWorkers.emplace_back([this](){ work(); });
+		}
+	}
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	/**
+	 * Waits for all pending tasks and joins the worker threads.
+	 */
+	~ThreadPool() {
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mStop = true;
+		}
+		mCondition.notify_all();
+		for (auto& w: mWorkers) w.join();
+	}
+
+	/**
+	 * @return Number of worker threads.
+	 */
+	std::size_t size() const noexcept {
+		return mWorkers.size();
+	}
+
+	/**
+	 * Schedules the given function for execution.
+	 * @param f Function to execute.
+	 * @return Future for the result of f.
+	 */
+	template<typename F>
+	auto submit(F&& f) -> std::future<decltype(f())> {
+		using Result = decltype(f());
+		auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(f));
+		std::future<Result> res = task->get_future();
+		if (mWorkers.empty()) {
+			(*task)();
+			return res;
+		}
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mTasks.emplace([task](){ (*task)(); });
+		}
+		mCondition.notify_one();
+		return res;
+	}
+
+	/**
+	 * Calls f(i) for all i in [0, n) and waits until all calls have finished.
+	 * The indices are handed out dynamically, hence tasks of different cost are balanced among the workers.
+	 * The calling thread participates in the work.
+	 * @param n Number of indices.
+	 * @param f Function to call.
+	 */
+	template<typename F>
+	void parallelFor(std::size_t n, F&& f) {
+		std::atomic<std::size_t> next(0);
+		auto runner = [&next,&f,n](){
+			for (std::size_t i = next++; i < n; i = next++) f(i);
+		};
+		std::vector<std::future<void>> futures;
+		std::size_t helpers = std::min(mWorkers.size(), n);
+		futures.reserve(helpers);
+		for (std::size_t i = 0; i < helpers; i++) {
+			futures.push_back(submit(runner));
+		}
+		runner();
+		for (auto& fut: futures) fut.get();
+	}
+};
+
+}
@@ -11,6 +11,7 @@
 #include <limits>
 #include <stack>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "../io/streamingOperators.h"
@@ -750,6 +751,45 @@ public:
 		nodes.clear();
 		emptyNodes = MAXINT;
 	}
+	/**
+	 * Rebuilds the node storage such that it only contains the elements of the tree, grouped by their depth.
+	 * The memory of erased nodes is released and the children of every element are stored contiguously, which improves the memory locality of all traversals.
+	 * All iterators are invalidated.
+	 */
+	void compact() {
+		if (nodes.empty()) return;
+		// old ids in breadth-first order and their new ids
+		std::vector<std::size_t> order({ 0 });
+		std::vector<std::size_t> newIDs(nodes.size(), MAXINT);
+		newIDs[0] = 0;
+		for (std::size_t i = 0; i < order.size(); i++) {
+			for (std::size_t child = nodes[order[i]].firstChild; child != MAXINT; child = nodes[child].nextSibling) {
+				newIDs[child] = order.size();
+				order.push_back(child);
+			}
+		}
+		auto convert = [&newIDs](std::size_t id){ return id == MAXINT ? MAXINT : newIDs[id]; };
+		std::vector<Node> newNodes;
+		newNodes.reserve(order.size());
+		for (std::size_t id: order) {
+			Node& n = nodes[id];
+			newNodes.emplace_back(newIDs[id], std::move(n.data), convert(n.parent), n.depth);
+			newNodes.back().previousSibling = convert(n.previousSibling);
+			newNodes.back().nextSibling = convert(n.nextSibling);
+			newNodes.back().firstChild = convert(n.firstChild);
+			newNodes.back().lastChild = convert(n.lastChild);
+		}
+		std::swap(nodes, newNodes);
+		emptyNodes = MAXINT;
+		assert(isConsistent());
+	}
+	/**
+	 * Retrieves the number of nodes allocated, including erased nodes that have not been reused yet.
+	 * @return Number of allocated nodes.
+	 */
+	std::size_t allocated() const {
+		return nodes.size();
+	}
 	/**
 	 * Add the given data as last child of the root element.
 	 * @param data Data.
@@ -883,9 +923,20 @@ private:
 		} else {
 			newID = emptyNodes;
 			emptyNodes = nodes[emptyNodes].nextSibling;
+			// the children of an erased node are recycled lazily
+			if (nodes[newID].firstChild != MAXINT) {
+				for (std::size_t child = nodes[newID].firstChild; child != MAXINT; child = nodes[child].nextSibling) {
+					nodes[child].depth = MAXINT;
+				}
+				nodes[nodes[newID].lastChild].nextSibling = emptyNodes;
+				emptyNodes = nodes[newID].firstChild;
+			}
 			nodes[newID].data = data;
 			nodes[newID].parent = parent;
 			nodes[newID].depth = depth;
+			nodes[newID].previousSibling = MAXINT;
+			nodes[newID].firstChild = MAXINT;
+			nodes[newID].lastChild = MAXINT;
 		}
 		return newID;
 	}
@@ -904,19 +955,25 @@ private:
 		}
 		return res;
 	}
+	/**
+	 * Erases all children of the given node in time linear in the number of children, independent of the size of their subtrees.
+	 * The children are prepended to the list of empty nodes as a whole and their subtrees are recycled lazily once the nodes are reused.
+	 */
 	void eraseChildren(std::size_t id) {
 		if (nodes[id].firstChild == MAXINT) return;
-		std::size_t cur = nodes[id].firstChild;
-		while (cur != MAXINT) {
-			std::size_t tmp = cur;
-			cur = nodes[cur].nextSibling;
-			eraseNode(tmp);
+		for (std::size_t child = nodes[id].firstChild; child != MAXINT; child = nodes[child].nextSibling) {
+			nodes[child].depth = MAXINT;
 		}
+		nodes[nodes[id].lastChild].nextSibling = emptyNodes;
+		emptyNodes = nodes[id].firstChild;
 		nodes[id].firstChild = MAXINT;
 		nodes[id].lastChild = MAXINT;
 	}
+	/**
+	 * Erases the given node in constant time.
+	 * Its subtree is recycled lazily once the node is reused.
+	 */
 	void eraseNode(std::size_t id) {
-		eraseChildren(id);
 		nodes[id].nextSibling = emptyNodes;
 		nodes[id].previousSibling = MAXINT;
 		nodes[id].depth = MAXINT;
@@ -0,0 +1,351 @@
+/**
+ * @file GroebnerBenchmark.cpp
+ *
+ * Runs all Groebner basis procedures on the cyclic-n and katsura-n families,
+ * for several orderings and coefficient types.
+ * Every run is executed in a child process, such that its peak memory can be measured independently of the other runs.
+ * For every run, the wall time, the peak memory, the number of reductions and zero reductions
+ * and the size of the reduced basis are recorded and written as CSV.
+ * If a baseline, i.e. the CSV output of a former run, is given, the results are compared against it
+ * and the program fails if any run regressed.
+ * By default, only the machine independent measures, i.e. the basis size and the number of reductions, are compared.
+ * Time and memory depend on the machine the baseline was recorded on and are only compared with --check-time.
+ * The families are available up to cyclic-5 and katsura-5.
+ *
+ * Usage: example-GroebnerBenchmark [--cyclic n] [--katsura n] [--output file] [--baseline file] [--check-time] [--tolerance t] [--slack ms]
+ */
+
+#define BUCHBERGER_STATISTICS
+
+#include "carl/groebner/groebner.h"
+#include "carl/groebner/benchmarks/cyclic.h"
+#include "carl/groebner/benchmarks/katsura.h"
+#include "carl/core/MultivariatePolynomial.h"
+#include "carl/util/Timer.h"
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace carl;
+
+/**
+ * The measurements of a single run.
+ */
+struct BenchmarkResult
+{
+	std::string benchmark;
+	std::string procedure;
+	std::string ordering;
+	std::string coefficients;
+	std::size_t time = 0;
+	std::size_t memory = 0;
+	unsigned reductions = 0;
+	unsigned zeroReductions = 0;
+	std::size_t basisSize = 0;
+
+	std::string key() const
+	{
+		return benchmark + "," + procedure + "," + ordering + "," + coefficients;
+	}
+};
+
+static const char* csvHeader = "benchmark,procedure,ordering,coefficients,time_ms,peak_memory_kb,reductions,zero_reductions,basis_size";
+
+std::ostream& operator<<(std::ostream& os, const BenchmarkResult& r)
+{
+	return os << r.key() << "," << r.time << "," << r.memory << "," << r.reductions << "," << r.zeroReductions << "," << r.basisSize;
+}
+
+/// Largest n for which cyclic-n and katsura-n are available.
+static const unsigned maxBenchmarkIndex = 5;
+
+struct BenchmarkSettings
+{
+	unsigned maxCyclic = maxBenchmarkIndex;
+	unsigned maxKatsura = maxBenchmarkIndex;
+	std::string output;
+	std::string baseline;
+	/// Whether time and memory are compared against the baseline.
+	bool checkTime = false;
+	/// Relative tolerance for the time and the memory.
+	double tolerance = 0.25;
+	/// Absolute tolerance for the time in milliseconds, to ignore noise on small benchmarks.
+	std::size_t slack = 20;
+};
+
+/**
+ * Reads everything the child process wrote to the given file descriptor.
+ */
+std::string readAll(int fd)
+{
+	std::string res;
+	char buffer[256];
+	ssize_t n;
+	while((n = read(fd, buffer, sizeof(buffer))) > 0)
+	{
+		res.append(buffer, std::size_t(n));
+	}
+	return res;
+}
+
+template<typename C, typename O>
+class BenchmarkRunner
+{
+	using Polynomial = MultivariatePolynomial<C, O, StdMultivariatePolynomialPolicies<>>;
+
+	std::string mOrdering;
+	std::string mCoefficients;
+	std::vector<BenchmarkResult>& mResults;
+
+	/**
+	 * Computes the basis and stores time, reductions and basis size in the result.
+	 */
+	template<template<typename, template<typename> class> class Procedure>
+	static void measure(const std::vector<Polynomial>& input, BenchmarkResult& result)
+	{
+		BuchbergerStats* stats = BuchbergerStats::getInstance();
+		stats->reset();
+		Timer timer;
+		{
+			GBProcedure<Polynomial, Procedure, StdAdding> gb;
+			for(const Polynomial& p : input)
+			{
+				gb.addPolynomial(p);
+			}
+			gb.calculate();
+			result.basisSize = gb.getIdeal().nrGenerators();
+		}
+		result.time = timer.passed();
+		result.reductions = stats->getNrReductions();
+		result.zeroReductions = stats->getNrZeroReductions();
+	}
+
+	/**
+	 * Runs measure() in a child process, which reports its results through a pipe.
+	 * The peak memory is the maximum resident set size of the child.
+	 * It includes the memory the child shares with this process, which is the same for all runs.
+	 */
+	template<template<typename, template<typename> class> class Procedure>
+	void run(const std::string& procedure, const std::string& benchmark, const std::vector<Polynomial>& input)
+	{
+		BenchmarkResult result;
+		result.benchmark = benchmark;
+		result.procedure = procedure;
+		result.ordering = mOrdering;
+		result.coefficients = mCoefficients;
+
+		int fds[2];
+		if(pipe(fds) != 0)
+		{
+			std::cerr << "Could not create a pipe for " << result.key() << std::endl;
+			std::exit(2);
+		}
+		std::cout.flush();
+		pid_t pid = fork();
+		if(pid < 0)
+		{
+			std::cerr << "Could not fork for " << result.key() << std::endl;
+			std::exit(2);
+		}
+		if(pid == 0)
+		{
+			close(fds[0]);
+			measure<Procedure>(input, result);
+			std::string message = std::to_string(result.time) + " " + std::to_string(result.reductions) + " " + std::to_string(result.zeroReductions) + " " + std::to_string(result.basisSize);
+			bool written = write(fds[1], message.data(), message.size()) == ssize_t(message.size());
+			close(fds[1]);
+			// Do not run the destructors and exit handlers of the parent process.
+			_exit(written ? 0 : 1);
+		}
+		close(fds[1]);
+		std::stringstream message(readAll(fds[0]));
+		close(fds[0]);
+		int status;
+		struct rusage usage;
+		if(wait4(pid, &status, 0, &usage) != pid || !WIFEXITED(status) || WEXITSTATUS(status) != 0 || !(message >> result.time >> result.reductions >> result.zeroReductions >> result.basisSize))
+		{
+			std::cerr << "The run " << result.key() << " failed." << std::endl;
+			std::exit(2);
+		}
+		result.memory = std::size_t(usage.ru_maxrss);
+		std::cout << result << std::endl;
+		mResults.push_back(result);
+	}
+
+	void runProcedures(const std::string& benchmark, const std::vector<Polynomial>& input)
+	{
+		run<Buchberger>("Buchberger", benchmark, input);
+		run<SugarBuchberger>("SugarBuchberger", benchmark, input);
+		run<DegreeAgeBuchberger>("DegreeAgeBuchberger", benchmark, input);
+		run<ParallelBuchberger>("ParallelBuchberger", benchmark, input);
+		run<F4>("F4", benchmark, input);
+		run<SignatureBased>("SignatureBased", benchmark, input);
+		run<MultiModular>("MultiModular", benchmark, input);
+	}
+
+public:
+	BenchmarkRunner(const std::string& ordering, const std::string& coefficients, std::vector<BenchmarkResult>& results):
+		mOrdering(ordering), mCoefficients(coefficients), mResults(results)
+	{}
+
+	void execute(const BenchmarkSettings& settings)
+	{
+		for(unsigned n = 2; n <= settings.maxCyclic; ++n)
+		{
+			runProcedures("cyclic-" + std::to_string(n), benchmarks::cyclic<C, O, StdMultivariatePolynomialPolicies<>>(n));
+		}
+		for(unsigned n = 2; n <= settings.maxKatsura; ++n)
+		{
+			runProcedures("katsura-" + std::to_string(n), benchmarks::katsura<C, O, StdMultivariatePolynomialPolicies<>>(n));
+		}
+	}
+};
+
+/**
+ * Reads the results of a former run, indexed by their key.
+ */
+bool readBaseline(const std::string& filename, std::map<std::string, BenchmarkResult>& baseline)
+{
+	std::ifstream in(filename);
+	if(!in) return false;
+	std::string line;
+	std::getline(in, line);
+	if(line != csvHeader) return false;
+	while(std::getline(in, line))
+	{
+		if(line.empty()) continue;
+		std::stringstream ss(line);
+		std::vector<std::string> fields;
+		std::string field;
+		while(std::getline(ss, field, ',')) fields.push_back(field);
+		if(fields.size() != 9) return false;
+		BenchmarkResult r;
+		r.benchmark = fields[0];
+		r.procedure = fields[1];
+		r.ordering = fields[2];
+		r.coefficients = fields[3];
+		r.time = std::stoul(fields[4]);
+		r.memory = std::stoul(fields[5]);
+		r.reductions = unsigned(std::stoul(fields[6]));
+		r.zeroReductions = unsigned(std::stoul(fields[7]));
+		r.basisSize = std::stoul(fields[8]);
+		baseline.emplace(r.key(), r);
+	}
+	return true;
+}
+
+/**
+ * Compares the results against the baseline.
+ * The basis size must be equal and the number of reductions must not grow.
+ * If settings.checkTime is set, time and memory may additionally only grow within the tolerance.
+ * @return The number of regressions.
+ */
+std::size_t compare(const std::vector<BenchmarkResult>& results, const std::map<std::string, BenchmarkResult>& baseline, const BenchmarkSettings& settings)
+{
+	std::size_t regressions = 0;
+	auto exceeds = [&settings](std::size_t value, std::size_t reference, std::size_t slack) {
+		return double(value) > double(reference) * (1 + settings.tolerance) + double(slack);
+	};
+	for(const BenchmarkResult& r : results)
+	{
+		auto it = baseline.find(r.key());
+		if(it == baseline.end())
+		{
+			std::cout << "New:        " << r.key() << std::endl;
+			continue;
+		}
+		const BenchmarkResult& b = it->second;
+		std::vector<std::string> reasons;
+		if(r.basisSize != b.basisSize) reasons.push_back("basis size " + std::to_string(b.basisSize) + " -> " + std::to_string(r.basisSize));
+		if(r.reductions > b.reductions) reasons.push_back("reductions " + std::to_string(b.reductions) + " -> " + std::to_string(r.reductions));
+		if(r.zeroReductions > b.zeroReductions) reasons.push_back("zero reductions " + std::to_string(b.zeroReductions) + " -> " + std::to_string(r.zeroReductions));
+		if(settings.checkTime)
+		{
+			if(exceeds(r.time, b.time, settings.slack)) reasons.push_back("time " + std::to_string(b.time) + "ms -> " + std::to_string(r.time) + "ms");
+			if(exceeds(r.memory, b.memory, 0)) reasons.push_back("memory " + std::to_string(b.memory) + "kB -> " + std::to_string(r.memory) + "kB");
+		}
+		if(reasons.empty()) continue;
+		++regressions;
+		std::cout << "Regression: " << r.key() << ":";
+		for(const std::string& reason : reasons) std::cout << " " << reason << ";";
+		std::cout << std::endl;
+	}
+	return regressions;
+}
+
+bool parseArguments(int argc, char** argv, BenchmarkSettings& settings)
+{
+	for(int i = 1; i < argc; ++i)
+	{
+		std::string arg(argv[i]);
+		if(arg == "--check-time")
+		{
+			settings.checkTime = true;
+			continue;
+		}
+		if(i + 1 == argc) return false;
+		std::string value(argv[++i]);
+		if(arg == "--cyclic") settings.maxCyclic = unsigned(std::stoul(value));
+		else if(arg == "--katsura") settings.maxKatsura = unsigned(std::stoul(value));
+		else if(arg == "--output") settings.output = value;
+		else if(arg == "--baseline") settings.baseline = value;
+		else if(arg == "--tolerance") settings.tolerance = std::stod(value);
+		else if(arg == "--slack") settings.slack = std::stoul(value);
+		else return false;
+	}
+	if(settings.maxCyclic > maxBenchmarkIndex || settings.maxKatsura > maxBenchmarkIndex)
+	{
+		std::cerr << "cyclic-n and katsura-n are only available for n <= " << maxBenchmarkIndex << "." << std::endl;
+		return false;
+	}
+	return true;
+}
+
+int main(int argc, char** argv)
+{
+	BenchmarkSettings settings;
+	if(!parseArguments(argc, argv, settings))
+	{
+		std::cerr << "Usage: " << argv[0] << " [--cyclic n] [--katsura n] [--output file] [--baseline file] [--check-time] [--tolerance t] [--slack ms]" << std::endl;
+		return 2;
+	}
+
+	std::vector<BenchmarkResult> results;
+	std::cout << csvHeader << std::endl;
+	BenchmarkRunner<mpq_class, GrLexOrdering>("grlex", "mpq", results).execute(settings);
+	BenchmarkRunner<mpq_class, GrRevLexOrdering>("grevlex", "mpq", results).execute(settings);
+#ifdef USE_CLN_NUMBERS
+	BenchmarkRunner<cln::cl_RA, GrLexOrdering>("grlex", "cln", results).execute(settings);
+	BenchmarkRunner<cln::cl_RA, GrRevLexOrdering>("grevlex", "cln", results).execute(settings);
+#endif
+
+	if(!settings.output.empty())
+	{
+		std::ofstream out(settings.output);
+		out << csvHeader << std::endl;
+		for(const BenchmarkResult& r : results) out << r << std::endl;
+	}
+
+	if(!settings.baseline.empty())
+	{
+		std::map<std::string, BenchmarkResult> baseline;
+		if(!readBaseline(settings.baseline, baseline))
+		{
+			std::cerr << "Could not read baseline " << settings.baseline << std::endl;
+			return 2;
+		}
+		std::size_t regressions = compare(results, baseline, settings);
+		std::cout << regressions << " regressions in " << results.size() << " runs." << std::endl;
+		if(regressions > 0) return 1;
+	}
+	return 0;
+}
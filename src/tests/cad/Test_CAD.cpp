@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <list>
+#include <set>
 #include <vector>
 
 #include "carl/core/logging.h"
@@ -251,6 +252,393 @@ TEST_F(CADTest, Check9)
 	for (auto c: cons) EXPECT_TRUE(c.satisfiedBy(r, cad.getVariables()));
 }
 
+TEST_F(CADTest, ParallelProjection)
+{
+	carl::CAD<Rational> parallel;
+	cad::CADSettings setting = parallel.getSetting();
+	setting.projectionThreads = 4;
+	parallel.alterSetting(setting);
+
+	std::vector<Constraint> cons;
+	for (std::size_t i: {3, 4, 5, 8}) {
+		this->cad.addPolynomial(this->p[i], {x, y, z});
+		parallel.addPolynomial(this->p[i], {x, y, z});
+	}
+	cons.assign({
+		Constraint(this->p[3], Sign::NEGATIVE, {x,y,z}),
+		Constraint(this->p[4], Sign::POSITIVE, {x,y,z}),
+		Constraint(this->p[5], Sign::POSITIVE, {x,y,z}),
+		Constraint(this->p[8], Sign::NEGATIVE, {x,y,z})
+	});
+	RealAlgebraicPoint<Rational> r1;
+	RealAlgebraicPoint<Rational> r2;
+	EXPECT_EQ(carl::cad::Answer::True, this->cad.check(cons, r1, this->bounds));
+	EXPECT_EQ(carl::cad::Answer::True, parallel.check(cons, r2, this->bounds));
+	for (auto c: cons) EXPECT_TRUE(c.satisfiedBy(r2, parallel.getVariables()));
+	ASSERT_EQ(this->cad.getEliminationSets().size(), parallel.getEliminationSets().size());
+	for (std::size_t l = 0; l < parallel.getEliminationSets().size(); l++) {
+		EXPECT_EQ(this->cad.getEliminationSet(l).size(), parallel.getEliminationSet(l).size());
+	}
+}
+
+TEST_F(CADTest, ParallelProjectionFactorization)
+{
+	// the discriminant of y^2 - x^3 + 2x^2 + x - 2 with respect to y is a multiple of (x-1)(x+1)(x-2)
+	Polynomial q({Term<Rational>(y)*y, Term<Rational>(-1)*x*x*x, Term<Rational>(2)*x*x, Term<Rational>(x), Term<Rational>(Rational(-2))});
+	auto projections = [&](std::size_t threads) {
+		carl::CAD<Rational> c;
+		cad::CADSettings setting = c.getSetting();
+		setting.projectionThreads = threads;
+		setting.simplifyByFactorization = true;
+		c.alterSetting(setting);
+		c.addPolynomial(this->p[0], {y, x});
+		c.addPolynomial(q, {y, x});
+		c.prepareElimination();
+		c.completeElimination();
+		std::vector<std::set<Polynomial>> res;
+		for (const auto& level: c.getEliminationSets()) {
+			res.emplace_back();
+			for (const auto& p: level.getPolynomials()) res.back().insert(Polynomial(*p).normalize());
+		}
+		return res;
+	};
+	auto sequential = projections(1);
+	auto parallel = projections(4);
+	EXPECT_EQ(sequential, parallel);
+	ASSERT_EQ(2, parallel.size());
+	EXPECT_TRUE(parallel[1].count(Polynomial({Term<Rational>(x)*x*x, Term<Rational>(-2)*x*x, Term<Rational>(-1)*x, Term<Rational>(2)})) > 0);
+}
+
+#ifdef THREAD_SAFE
+// Without THREAD_SAFE, all projections are computed sequentially, hence only here several threads project concurrently.
+TEST_F(CADTest, ParallelProjectionConcurrent)
+{
+	auto projections = [&](std::size_t threads, bool factorize) {
+		carl::CAD<Rational> c;
+		cad::CADSettings setting = c.getSetting();
+		setting.projectionThreads = threads;
+		setting.simplifyByFactorization = factorize;
+		c.alterSetting(setting);
+		for (std::size_t i: {3, 4, 5, 8}) c.addPolynomial(this->p[i], {x, y, z});
+		c.prepareElimination();
+		c.completeElimination();
+		std::vector<std::set<Polynomial>> res;
+		for (const auto& level: c.getEliminationSets()) {
+			res.emplace_back();
+			for (const auto& p: level.getPolynomials()) res.back().insert(Polynomial(*p).normalize());
+		}
+		return res;
+	};
+	for (bool factorize: {false, true}) {
+		auto sequential = projections(1, factorize);
+		ASSERT_EQ(3, sequential.size());
+		for (std::size_t threads: {2, 3, 8}) {
+			EXPECT_EQ(sequential, projections(threads, factorize));
+		}
+	}
+}
+#endif
+
+TEST_F(CADTest, ParallelLifting)
+{
+	carl::CAD<Rational> parallel;
+	cad::CADSettings setting = parallel.getSetting();
+	setting.liftingThreads = 4;
+	parallel.alterSetting(setting);
+
+	RealAlgebraicPoint<Rational> r1;
+	RealAlgebraicPoint<Rational> r2;
+	std::vector<Constraint> cons;
+	for (std::size_t i: {0, 1}) {
+		this->cad.addPolynomial(this->p[i], {x, y});
+		parallel.addPolynomial(this->p[i], {x, y});
+	}
+	cons.assign({
+		Constraint(this->p[0], Sign::ZERO, {x,y}),
+		Constraint(this->p[1], Sign::ZERO, {x,y})
+	});
+	EXPECT_EQ(carl::cad::Answer::True, this->cad.check(cons, r1, this->bounds));
+	EXPECT_EQ(carl::cad::Answer::True, parallel.check(cons, r2, this->bounds));
+	for (auto c: cons) EXPECT_TRUE(c.satisfiedBy(r2, parallel.getVariables()));
+
+	// the new polynomial yields lifting positions for the nodes already present in the sample tree
+	this->cad.addPolynomial(this->p[2], {x, y});
+	parallel.addPolynomial(this->p[2], {x, y});
+	cons.push_back(Constraint(this->p[2], Sign::ZERO, {x,y}));
+	EXPECT_EQ(carl::cad::Answer::False, this->cad.check(cons, r1, this->bounds));
+	EXPECT_EQ(carl::cad::Answer::False, parallel.check(cons, r2, this->bounds));
+	EXPECT_EQ(this->cad.samples().size(), parallel.samples().size());
+
+	cons.pop_back();
+	cons.pop_back();
+	cons.push_back(Constraint(this->p[2], Sign::ZERO, {x,y}));
+	EXPECT_EQ(carl::cad::Answer::True, parallel.check(cons, r2, this->bounds));
+	for (auto c: cons) EXPECT_TRUE(c.satisfiedBy(r2, parallel.getVariables()));
+}
+
+#ifdef THREAD_SAFE
+// Without THREAD_SAFE, all nodes are lifted sequentially, hence only here several workers run concurrently.
+TEST_F(CADTest, ParallelLiftingConcurrent)
+{
+	RealAlgebraicPoint<Rational> r;
+	std::vector<Constraint> cons;
+	for (std::size_t i: {0, 1}) this->cad.addPolynomial(this->p[i], {x, y});
+	cons.assign({
+		Constraint(this->p[0], Sign::ZERO, {x,y}),
+		Constraint(this->p[1], Sign::ZERO, {x,y})
+	});
+	EXPECT_EQ(carl::cad::Answer::True, this->cad.check(cons, r, this->bounds));
+	this->cad.addPolynomial(this->p[2], {x, y});
+	cons.push_back(Constraint(this->p[2], Sign::ZERO, {x,y}));
+	EXPECT_EQ(carl::cad::Answer::False, this->cad.check(cons, r, this->bounds));
+
+	for (std::size_t threads: {2, 3, 8}) {
+		carl::CAD<Rational> parallel;
+		cad::CADSettings setting = parallel.getSetting();
+		setting.liftingThreads = threads;
+		parallel.alterSetting(setting);
+		for (std::size_t i: {0, 1}) parallel.addPolynomial(this->p[i], {x, y});
+		cons.pop_back();
+		EXPECT_EQ(carl::cad::Answer::True, parallel.check(cons, r, this->bounds));
+		for (auto c: cons) EXPECT_TRUE(c.satisfiedBy(r, parallel.getVariables()));
+
+		// all nodes present in the sample tree are lifted at the new lifting positions, by several workers at once
+		parallel.addPolynomial(this->p[2], {x, y});
+		cons.push_back(Constraint(this->p[2], Sign::ZERO, {x,y}));
+		EXPECT_EQ(carl::cad::Answer::False, parallel.check(cons, r, this->bounds));
+		EXPECT_EQ(this->cad.samples().size(), parallel.samples().size());
+		EXPECT_TRUE(parallel.getSampleTree().isConsistent());
+	}
+}
+#endif
+
+TEST_F(CADTest, ProjectionOperators)
+{
+	for (auto pt: {cad::ProjectionType::Brown, cad::ProjectionType::McCallum, cad::ProjectionType::Hong, cad::ProjectionType::Lazard}) {
+		for (bool minimize: {false, true}) {
+			carl::CAD<Rational> c;
+			cad::CADSettings setting = c.getSetting();
+			setting.projectionType = pt;
+			setting.minimizeProjection = minimize;
+			c.alterSetting(setting);
+
+			RealAlgebraicPoint<Rational> r;
+			std::vector<Constraint> cons;
+			for (std::size_t i: {3, 4, 5}) {
+				c.addPolynomial(this->p[i], {x, y, z});
+			}
+			cons.assign({
+				Constraint(this->p[3], Sign::NEGATIVE, {x,y,z}),
+				Constraint(this->p[4], Sign::POSITIVE, {x,y,z}),
+				Constraint(this->p[5], Sign::POSITIVE, {x,y,z})
+			});
+			EXPECT_EQ(carl::cad::Answer::True, c.check(cons, r, this->bounds)) << pt;
+			for (auto con: cons) EXPECT_TRUE(con.satisfiedBy(r, c.getVariables())) << pt;
+
+			cons.push_back(Constraint(this->p[4], Sign::ZERO, {x,y,z}));
+			EXPECT_EQ(carl::cad::Answer::False, c.check(cons, r, this->bounds)) << pt;
+		}
+	}
+}
+
+TEST_F(CADTest, ProjectionCache)
+{
+	auto& cache = cad::ProjectionCache<Rational>::getInstance();
+	cache.clear();
+	carl::CAD<Rational> second;
+	carl::CAD<Rational> uncached;
+	cad::CADSettings setting = uncached.getSetting();
+	EXPECT_FALSE(setting.useProjectionCache);
+	setting.useProjectionCache = true;
+	this->cad.alterSetting(setting);
+	second.alterSetting(setting);
+
+	std::vector<Constraint> cons;
+	for (std::size_t i: {3, 4, 5, 8}) {
+		this->cad.addPolynomial(this->p[i], {x, y, z});
+		second.addPolynomial(this->p[i], {x, y, z});
+		uncached.addPolynomial(this->p[i], {x, y, z});
+	}
+	cons.assign({
+		Constraint(this->p[3], Sign::NEGATIVE, {x,y,z}),
+		Constraint(this->p[4], Sign::POSITIVE, {x,y,z}),
+		Constraint(this->p[5], Sign::POSITIVE, {x,y,z}),
+		Constraint(this->p[8], Sign::NEGATIVE, {x,y,z})
+	});
+	RealAlgebraicPoint<Rational> r;
+	EXPECT_EQ(carl::cad::Answer::True, this->cad.check(cons, r, this->bounds));
+	EXPECT_EQ(0, cache.hits());
+	EXPECT_LT(0, cache.size());
+	std::size_t misses = cache.misses();
+
+	EXPECT_EQ(carl::cad::Answer::True, second.check(cons, r, this->bounds));
+	for (auto c: cons) EXPECT_TRUE(c.satisfiedBy(r, second.getVariables()));
+	EXPECT_EQ(misses, cache.misses());
+	EXPECT_LT(0, cache.hits());
+
+	EXPECT_EQ(carl::cad::Answer::True, uncached.check(cons, r, this->bounds));
+	ASSERT_EQ(uncached.getEliminationSets().size(), second.getEliminationSets().size());
+	for (std::size_t l = 0; l < second.getEliminationSets().size(); l++) {
+		EXPECT_EQ(uncached.getEliminationSet(l).size(), second.getEliminationSet(l).size());
+	}
+
+	cache.setCapacity(1);
+	EXPECT_EQ(1, cache.size());
+	cache.setCapacity(4096);
+	cache.clear();
+}
+
+TEST_F(CADTest, Incremental)
+{
+	RealAlgebraicPoint<Rational> r;
+	std::vector<Constraint> cons;
+	this->cad.addPolynomial(this->p[0], {x, y});
+	cons.assign({
+		Constraint(this->p[0], Sign::ZERO, {x,y}),
+		Constraint(this->p[0], Sign::POSITIVE, {x,y})
+	});
+	ASSERT_EQ(carl::cad::Answer::False, cad.check(cons, r, this->bounds));
+	ASSERT_TRUE(cad.isComplete());
+	std::size_t samples = cad.samples().size();
+
+	// the cells of the complete CAD are refined by the new polynomial
+	this->cad.addPolynomial(this->p[2], {x, y});
+	cons.assign({
+		Constraint(this->p[0], Sign::ZERO, {x,y}),
+		Constraint(this->p[2], Sign::ZERO, {x,y})
+	});
+	ASSERT_EQ(carl::cad::Answer::True, cad.check(cons, r, this->bounds));
+	ASSERT_TRUE(cons[0].satisfiedBy(r, cad.getVariables()));
+	ASSERT_TRUE(cons[1].satisfiedBy(r, cad.getVariables()));
+	ASSERT_TRUE(cad.samples().size() > samples);
+
+	// the cells separated by the removed polynomial are merged again
+	this->cad.removePolynomial(this->p[2]);
+	cons.assign({
+		Constraint(this->p[0], Sign::ZERO, {x,y}),
+		Constraint(this->p[0], Sign::POSITIVE, {x,y})
+	});
+	ASSERT_EQ(carl::cad::Answer::False, cad.check(cons, r, this->bounds));
+	ASSERT_TRUE(cad.samples().size() <= samples);
+	cons.assign({
+		Constraint(this->p[0], Sign::ZERO, {x,y})
+	});
+	ASSERT_EQ(carl::cad::Answer::True, cad.check(cons, r, this->bounds));
+	ASSERT_TRUE(cons[0].satisfiedBy(r, cad.getVariables()));
+}
+
+TEST_F(CADTest, SingleCell)
+{
+	this->cad.addPolynomial(this->p[0], {x, y});
+	this->cad.addPolynomial(this->p[1], {x, y});
+	this->cad.prepareElimination();
+	auto vars = this->cad.getVariables();
+	ASSERT_EQ(2, vars.size());
+	auto point = [&](Rational vx, Rational vy){
+		std::vector<RealAlgebraicNumber<Rational>> v;
+		for (auto var: vars) v.emplace_back(var == x ? vx : vy);
+		return RealAlgebraicPoint<Rational>(v);
+	};
+	std::vector<Constraint> cons({
+		Constraint(this->p[0], Sign::NEGATIVE, {x,y}),
+		Constraint(this->p[1], Sign::POSITIVE, {x,y})
+	});
+	cad::ConflictGraph<Rational> cg;
+	cad::Cell<Rational> cell;
+
+	// (0,0) satisfies both constraints
+	ASSERT_EQ(carl::cad::Answer::True, cad.checkCell(cons, point(0, 0), cell, cg));
+
+	// (2,0) violates x^2 + y^2 - 1 < 0 only
+	ASSERT_EQ(carl::cad::Answer::False, cad.checkCell(cons, point(2, 0), cell, cg));
+	ASSERT_EQ(vars.size(), cell.size());
+	for (std::size_t i = 0; i < vars.size(); i++) {
+		EXPECT_EQ(vars[i], cell[i].variable);
+		EXPECT_FALSE(cell[i].section);
+	}
+	// the cell is 1 < x over -1 < y < 1
+	ASSERT_EQ(x, vars.front());
+	const auto& top = cell.front();
+	const auto& base = cell.back();
+	EXPECT_TRUE(base.contains(RealAlgebraicNumber<Rational>(Rational(1)/2)));
+	EXPECT_FALSE(base.contains(RealAlgebraicNumber<Rational>(Rational(3)/2)));
+	ASSERT_TRUE(top.lower != nullptr);
+	EXPECT_TRUE(top.lowerRoot == RealAlgebraicNumber<Rational>(Rational(1)));
+	EXPECT_TRUE(top.upper == nullptr);
+	EXPECT_TRUE(top.contains(RealAlgebraicNumber<Rational>(Rational(5))));
+	EXPECT_FALSE(top.contains(RealAlgebraicNumber<Rational>(Rational(0))));
+
+	// (0,1) is a root of both polynomials
+	ASSERT_EQ(carl::cad::Answer::False, cad.checkCell(cons, point(0, 1), cell, cg));
+	EXPECT_TRUE(cell.front().section);
+}
+
+TEST_F(CADTest, SignCache)
+{
+	RealAlgebraicPoint<Rational> r;
+	// p[10] = y^2 - 2 only depends on y, its sign is shared by all samples over the same y
+	std::vector<Constraint> cons({
+		Constraint(this->p[0], Sign::NEGATIVE, {x,y}),
+		Constraint(this->p[10], Sign::POSITIVE, {y})
+	});
+	cad::CADSettings setting = cad::CADSettings::getSettings();
+	for (bool cache: {true, false}) {
+		setting.cacheConstraintSigns = cache;
+		CAD<Rational> c(setting);
+		c.addPolynomial(this->p[0], {x, y});
+		c.addPolynomial(this->p[10], {y});
+		ASSERT_EQ(carl::cad::Answer::False, c.check(cons, r, this->bounds));
+		if (cache) {
+			EXPECT_TRUE(c.getSignCache().hits() > 0);
+			EXPECT_TRUE(c.getSignCache().size() > 0);
+		} else {
+			EXPECT_EQ(0, c.getSignCache().size());
+		}
+		// the cached signs are reused by the next check
+		cons[1] = Constraint(this->p[10], Sign::NEGATIVE, {y});
+		ASSERT_EQ(carl::cad::Answer::True, c.check(cons, r, this->bounds));
+		for (const auto& con: cons) EXPECT_TRUE(con.satisfiedBy(r, c.getVariables()));
+		cons[1] = Constraint(this->p[10], Sign::POSITIVE, {y});
+	}
+}
+
+TEST_F(CADTest, BoundPropagation)
+{
+	RealAlgebraicPoint<Rational> r;
+	Interval<Rational> unit(Rational(0), BoundType::WEAK, Rational(1), BoundType::WEAK);
+	cad::CADSettings setting = cad::CADSettings::getSettings();
+	for (bool propagate: {false, true}) {
+		for (bool conflictGraph: {false, true}) {
+			setting.propagateBounds = propagate;
+			setting.computeConflictGraph = conflictGraph;
+			// y = x + 1 leaves the unit disk within the unit box
+			std::vector<Constraint> cons({
+				Constraint(this->p[0], Sign::NEGATIVE, {x,y}),
+				Constraint(this->p[1], Sign::ZERO, {x,y})
+			});
+			// check() may shrink the bounds
+			this->bounds[0] = unit;
+			this->bounds[1] = unit;
+			CAD<Rational> c(setting);
+			c.addPolynomial(this->p[0], {x, y});
+			c.addPolynomial(this->p[1], {x, y});
+			EXPECT_EQ(carl::cad::Answer::False, c.check(cons, r, this->bounds));
+
+			// x = y within the unit disk and the unit box
+			cons[1] = Constraint(this->p[2], Sign::ZERO, {x,y});
+			this->bounds[0] = unit;
+			this->bounds[1] = unit;
+			CAD<Rational> d(setting);
+			d.addPolynomial(this->p[0], {x, y});
+			d.addPolynomial(this->p[2], {x, y});
+			ASSERT_EQ(carl::cad::Answer::True, d.check(cons, r, this->bounds));
+			for (const auto& con: cons) EXPECT_TRUE(con.satisfiedBy(r, d.getVariables()));
+			EXPECT_TRUE(r[0].containedIn(unit));
+			EXPECT_TRUE(r[1].containedIn(unit));
+		}
+	}
+}
+
 TEST_F(CADTest, CheckInt)
 {
 	RealAlgebraicPoint<Rational> r;
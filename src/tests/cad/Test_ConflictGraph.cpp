@@ -1,7 +1,9 @@
 #include "gtest/gtest.h"
 
+#include <algorithm>
 #include <memory>
 #include <list>
+#include <vector>
 
 #include "carl/cad/ConflictGraph.h"
 #include "carl/util/platform.h"
@@ -14,3 +16,39 @@ TEST(ConflictGraph, BasicOperations)
 {
     cad::ConflictGraph<Rational> cg;
 }
+
+TEST(ConflictGraph, Cover)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	using Poly = MultivariatePolynomial<Rational>;
+	std::vector<cad::Constraint<Rational>> cons({
+		cad::Constraint<Rational>(Poly(x), Sign::NEGATIVE, {x}),
+		cad::Constraint<Rational>(Poly(y), Sign::POSITIVE, {y}),
+		cad::Constraint<Rational>(Poly(x) - y, Sign::ZERO, {x,y})
+	});
+	// samples 0-3 violate cons[0], samples 0,1,4 violate cons[1], samples 2,3,5 violate cons[2]
+	std::vector<std::vector<std::size_t>> violated({{0,1,2,3}, {0,1,4}, {2,3,5}});
+	cad::ConflictGraph<Rational> cg;
+	for (std::size_t s = 0; s < 6; s++) {
+		std::size_t sample = cg.newSample();
+		for (std::size_t c = 0; c < cons.size(); c++) {
+			if (std::find(violated[c].begin(), violated[c].end(), s) != violated[c].end()) {
+				cg.set(cg.getConstraint(cons[c]), sample, true);
+			}
+		}
+	}
+	ASSERT_TRUE(cg.hasRemainingSamples());
+
+	// the greedy cover starts with cons[0]
+	EXPECT_EQ(3, cg.getCover().size());
+	auto exact = cg.getCover(10);
+	ASSERT_EQ(2, exact.size());
+	EXPECT_TRUE(std::find(exact.begin(), exact.end(), cons[0]) == exact.end());
+
+	EXPECT_EQ(cg.getConstraint(cons[0]), cg.getMaxDegreeConstraint());
+	cg.selectConstraint(cg.getConstraint(cons[1]));
+	EXPECT_TRUE(cg.hasRemainingSamples());
+	cg.selectConstraint(cg.getConstraint(cons[2]));
+	EXPECT_FALSE(cg.hasRemainingSamples());
+}
@@ -1,5 +1,6 @@
 #include "gtest/gtest.h"
 
+#include <algorithm>
 #include <memory>
 #include <list>
 
@@ -68,3 +69,49 @@ TEST(EliminationSet, SetProperty)
 	}
 	EXPECT_EQ((unsigned)1, s.size());
 }
+
+namespace {
+	/// Collects the projection polynomials as multivariate polynomials.
+	struct CollectingInserter {
+		std::vector<cad::MPolynomial<Rational>> polynomials;
+		void insert(const cad::UPolynomial<Rational>& p, const std::list<const cad::UPolynomial<Rational>*>&, bool) {
+			polynomials.push_back(cad::MPolynomial<Rational>(p));
+		}
+		bool contains(const cad::MPolynomial<Rational>& p) const {
+			return std::find(polynomials.begin(), polynomials.end(), p) != polynomials.end();
+		}
+	};
+}
+
+TEST(EliminationSet, ProjectionCoefficients)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+	cad::MPolynomial<Rational> mx(x);
+	cad::MPolynomial<Rational> my(y);
+	cad::MPolynomial<Rational> definite = mx*mx + cad::MPolynomial<Rational>(1);
+
+	// x*z^2 + y*z + x vanishes identically for x = y = 0, hence Lazard's projection needs all coefficients.
+	cad::UPolynomial<Rational> nullifying(z, {mx, my, mx});
+	cad::ProjectionOperator<const cad::UPolynomial<Rational>*> projection;
+	CollectingInserter lazard;
+	projection(cad::ProjectionType::Lazard, &nullifying, y, lazard);
+	EXPECT_TRUE(lazard.contains(my));
+
+	// (x^2+1)*z^2 + y*z + x does not vanish identically, its middle coefficient is not needed.
+	cad::UPolynomial<Rational> regular(z, {mx, my, definite});
+	CollectingInserter lazardRegular;
+	projection(cad::ProjectionType::Lazard, &regular, y, lazardRegular);
+	EXPECT_FALSE(lazardRegular.contains(my));
+	EXPECT_TRUE(lazardRegular.contains(mx));
+
+	// Minimization omits definite coefficients in McCallum's projection.
+	for (bool minimize: {false, true}) {
+		cad::ProjectionOperator<const cad::UPolynomial<Rational>*> minimizing(minimize);
+		CollectingInserter mccallum;
+		minimizing(cad::ProjectionType::McCallum, &regular, y, mccallum);
+		EXPECT_EQ(!minimize, mccallum.contains(definite));
+		EXPECT_TRUE(mccallum.contains(my));
+	}
+}
@@ -40,3 +40,28 @@ TEST(SampleSet, SampleComparator)
 	
 	expectRightOrder(samples, comp);
 }
+
+TEST(SampleSet, RemoveArbitrary)
+{
+	cad::SampleSet<Rational> s(cad::SampleOrdering::Value);
+	for (int i = 0; i < 20; i++) {
+		s.insert(RealAlgebraicNumber<Rational>(Rational((i * 7) % 20)));
+	}
+	for (auto it = s.begin(); it != s.end();) {
+		if (carl::isZero(carl::mod(carl::getNum(it->value()), 3))) {
+			it = s.remove(it);
+		} else {
+			it++;
+		}
+	}
+	cad::SampleSet<Rational> copy(s);
+	Rational last = 20;
+	while (!copy.empty()) {
+		Rational cur = copy.next().value();
+		EXPECT_TRUE(cur < last);
+		EXPECT_FALSE(carl::isZero(carl::mod(carl::getNum(cur), 3)));
+		last = cur;
+		copy.pop();
+	}
+	EXPECT_EQ(s.samples().size(), std::size_t(13));
+}
@@ -68,6 +68,59 @@ TEST(Thom, SignDetermination) {
         sd3.getSignsAndAdd(ellipse.derivative(y));
 }
 
+TEST(Thom, SignDeterminationReuse) {
+        typedef UnivariatePolynomial<Rational> UPolynomial;
+        typedef MultivariatePolynomial<Rational> MPolynomial;
+        Variable x = freshRealVariable("x");
+
+        // zero set {-5, ..., 4}
+        MPolynomial product(Rational(1));
+        for(int i = -5; i < 5; i++) {
+                product = product * MPolynomial(UPolynomial(x, {Rational(-i), Rational(1)}));
+        }
+        std::vector<MPolynomial> zeroSet = {product};
+
+        TarskiQueryManager<Rational> taq(zeroSet.begin(), zeroSet.end());
+        std::vector<MPolynomial> queries = {MPolynomial(Rational(1)), MPolynomial(x), MPolynomial(x) + product, product};
+        auto results = taq(queries.begin(), queries.end());
+        ASSERT_EQ(4, results.size());
+        EXPECT_EQ(10, results[0]);
+        EXPECT_EQ(-1, results[1]);
+        EXPECT_EQ(results[1], results[2]);
+        EXPECT_EQ(0, results[3]);
+
+        SignDetermination<Rational> sd(zeroSet.begin(), zeroSet.end());
+        MPolynomial p1(x);
+        MPolynomial p2 = MPolynomial(x) - Rational(2);
+        EXPECT_EQ(3, sd.getSignsAndAdd(p1).size());
+        auto signs = sd.getSigns(p2);
+        EXPECT_EQ(signs, sd.getSigns(p2));
+        EXPECT_EQ(5, signs.size());
+        EXPECT_EQ(signs, sd.getSignsAndAdd(p2));
+        EXPECT_EQ(5, sd.signs().size());
+        EXPECT_EQ(6, sd.getSigns(MPolynomial(x) + Rational(1)).size());
+}
+
+TEST(Thom, MultivariateTarskiQuery) {
+        typedef MultivariatePolynomial<Rational> MPolynomial;
+        Variable x = freshRealVariable("x");
+        Variable y = freshRealVariable("y");
+
+        // zero set {(+-sqrt(2), +-sqrt(3))}
+        MPolynomial px = MPolynomial(x) * MPolynomial(x) - Rational(2);
+        MPolynomial py = MPolynomial(y) * MPolynomial(y) - Rational(3);
+        std::vector<MPolynomial> zeroSet = {px, py};
+        TarskiQueryManager<Rational> taq(zeroSet.begin(), zeroSet.end());
+
+        EXPECT_EQ(4, taq(MPolynomial(Rational(1))));
+        EXPECT_EQ(0, taq(MPolynomial(x)));
+        EXPECT_EQ(0, taq(MPolynomial(x) * MPolynomial(y) - Rational(1)));
+        EXPECT_EQ(4, taq(MPolynomial(x) + Rational(3, 2)));
+        EXPECT_EQ(4, taq(MPolynomial(x) * MPolynomial(x) + MPolynomial(y)));
+        EXPECT_EQ(-4, taq(MPolynomial(y) * MPolynomial(y) - Rational(4)));
+        EXPECT_EQ(0, taq(px));
+}
+
 
 TEST(Thom, RootFinder) {
         typedef MultivariatePolynomial<Rational> Polynomial;
@@ -103,6 +156,37 @@ TEST(Thom, RootFinder) {
         
 }
 
+TEST(Thom, RootQueue) {
+        typedef MultivariatePolynomial<Rational> Polynomial;
+        Variable x = freshRealVariable("x");
+        
+        // roots -1, 0, 1
+        Polynomial p({Rational(1)*x*x*x*x*x, Rational(-1)*x});
+        
+        ThomRootQueue<Rational> all(p, x, nullptr);
+        ASSERT_TRUE(all.hasNext());
+        EXPECT_TRUE(all.next() == Rational(-1));
+        EXPECT_TRUE(all.next() == Rational(0));
+        EXPECT_TRUE(all.next() == Rational(1));
+        EXPECT_FALSE(all.hasNext());
+        
+        ThomRootQueue<Rational> first(p, x, nullptr);
+        std::list<ThomEncoding<Rational>> roots = first.take(1);
+        ASSERT_EQ(1, roots.size());
+        EXPECT_TRUE(roots.front() == Rational(-1));
+        
+        ThomRootQueue<Rational> weak(p, x, nullptr, Interval<Rational>(Rational(0), BoundType::WEAK, Rational(2), BoundType::WEAK));
+        roots = weak.all();
+        ASSERT_EQ(2, roots.size());
+        EXPECT_TRUE(roots.front() == Rational(0));
+        EXPECT_TRUE(roots.back() == Rational(1));
+        
+        ThomRootQueue<Rational> strict(p, x, nullptr, Interval<Rational>(Rational(0), BoundType::STRICT, Rational(1), BoundType::STRICT));
+        EXPECT_FALSE(strict.hasNext());
+        
+        EXPECT_EQ(1, realRootsThom(p, x, std::map<Variable, ThomEncoding<Rational>>(), Interval<Rational>(Rational(-2), BoundType::STRICT, Rational(0), BoundType::STRICT)).size());
+}
+
 
 TEST(Thom, Comparison) {
         typedef MultivariatePolynomial<Rational> Polynomial;
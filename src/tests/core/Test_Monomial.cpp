@@ -2,6 +2,7 @@
 #include <carl/core/Variable.h>
 #include <carl/core/Monomial.h>
 #include <carl/core/MonomialPool.h>
+#include <carl/core/MonomialOrdering.h>
 #include <list>
 #include <boost/variant.hpp>
 
@@ -221,6 +222,55 @@ TEST(Monomial, OtherComparison)
 	expectRightOrder(list);
 }
 
+TEST(Monomial, GradedReverseLexicalComparison)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+
+	// x > y > z
+	std::vector<Monomial::Arg> monomials = { z*z, y*z, x*z, y*y, x*y, x*x, z*z*z, x*y*z, x*x*y };
+	for (std::size_t i = 0; i < monomials.size(); i++) {
+		for (std::size_t j = 0; j < monomials.size(); j++) {
+			EXPECT_EQ(i < j, GrRevLexOrdering::less(monomials[i], monomials[j])) << monomials[i] << " < " << monomials[j];
+		}
+	}
+	EXPECT_TRUE(GrRevLexOrdering::less(nullptr, createMonomial(z, 1)));
+	EXPECT_TRUE(GrRevLexOrdering::equal(x*y, y*x));
+
+	// GrLexOrdering breaks ties by lexicalCompare, where the larger exponent of the first differing variable is smaller
+	Monomial::Arg m1 = x*y*y*y*y*y*z*z;
+	Monomial::Arg m2 = x*x*x*x*y*z*z*z;
+	EXPECT_TRUE(GrLexOrdering::less(m2, m1));
+	EXPECT_TRUE(GrLexOrdering::less(x*x*z, x*y*y));
+}
+
+struct EliminateX
+{
+	static Variable& x() {
+		static Variable var = freshRealVariable("ex");
+		return var;
+	}
+	static bool contains(Variable::Arg v) {
+		return v == x();
+	}
+};
+
+TEST(Monomial, EliminationComparison)
+{
+	using Ordering = EliminationOrdering<EliminateX>;
+	Variable x = EliminateX::x();
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+
+	std::vector<Monomial::Arg> monomials = { createMonomial(z, 1), createMonomial(y, 1), y*z*z*z, y*y*y*y, createMonomial(x, 1), x*z, x*y*y, x*x };
+	for (std::size_t i = 0; i < monomials.size(); i++) {
+		for (std::size_t j = 0; j < monomials.size(); j++) {
+			EXPECT_EQ(i < j, Ordering::less(monomials[i], monomials[j])) << monomials[i] << " < " << monomials[j];
+		}
+	}
+}
+
 TEST(Monomial, sqrt)
 {
 	Variable x = freshRealVariable("x");
@@ -67,3 +67,18 @@ TEST(RealAlgebraicNumber, Evaluation2)
 	auto res = RealAlgebraicNumberEvaluation::evaluate(MultivariatePolynomial<Rational>(mp), point, vars);
 	std::cerr << res << std::endl;
 }
+
+TEST(RealAlgebraicNumber, SharedPolynomial)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	// Both roots of x^2 - 2, once in x and once in y.
+	RealAlgebraicNumber<Rational> a(UnivariatePolynomial<Rational>(x, {-2, 0, 1}), Interval<Rational>(1, BoundType::STRICT, 2, BoundType::STRICT));
+	RealAlgebraicNumber<Rational> b(UnivariatePolynomial<Rational>(y, {-2, 0, 1}), Interval<Rational>(-2, BoundType::STRICT, -1, BoundType::STRICT));
+	ASSERT_TRUE(a.isInterval());
+	ASSERT_TRUE(b.isInterval());
+	EXPECT_EQ(&a.getIRPolynomial(), &b.getIRPolynomial());
+	EXPECT_TRUE(b < a);
+	a.refine();
+	EXPECT_TRUE(a.containedIn(Interval<Rational>(1, BoundType::STRICT, 2, BoundType::STRICT)));
+}
@@ -449,3 +449,50 @@ TEST(UnivariatePolynomial, intervalCoeffs)
 	p *= p;
 	p += p;
 }
+
+template<typename T>
+void testTaylorShift() {
+	Variable x = freshRealVariable("x");
+	std::vector<T> coeffs;
+	for (int i = 0; i < 80; i++) coeffs.push_back(T((i * 7) % 11 - 5));
+	UnivariatePolynomial<T> p(x, coeffs);
+	for (const T& a: {T(1), T(-3), T(5)}) {
+		UnivariatePolynomial<T> horner(p);
+		horner.shift(a, TaylorShiftStrategy::Horner);
+		UnivariatePolynomial<T> dac(p);
+		dac.shift(a, TaylorShiftStrategy::DivideAndConquer);
+		UnivariatePolynomial<T> conv(p);
+		conv.shift(a, TaylorShiftStrategy::Convolution);
+		UnivariatePolynomial<T> automatic(p);
+		automatic.shift(a);
+		EXPECT_EQ(horner, dac);
+		EXPECT_EQ(horner, conv);
+		EXPECT_EQ(horner, automatic);
+		EXPECT_EQ(p.evaluate(T(2) + a), horner.evaluate(T(2)));
+	}
+}
+
+TYPED_TEST(UnivariatePolynomialIntTest, shift)
+{
+	testTaylorShift<TypeParam>();
+}
+
+TYPED_TEST(UnivariatePolynomialRatTest, shift)
+{
+	testTaylorShift<TypeParam>();
+}
+
+TEST(UnivariatePolynomial, multiplicationLarge)
+{
+	Variable x = freshRealVariable("x");
+	std::vector<Rational> pc, qc;
+	for (int i = 0; i < 100; i++) pc.push_back(Rational((i * 5) % 13 - 6));
+	for (int i = 0; i < 70; i++) qc.push_back(Rational((i * 3) % 7 - 3));
+	UnivariatePolynomial<Rational> p(x, pc);
+	UnivariatePolynomial<Rational> q(x, qc);
+	auto res = p * q;
+	EXPECT_EQ(res.degree(), p.degree() + q.degree());
+	for (const Rational& t: {Rational(0), Rational(1), Rational(-2), Rational(1,3)}) {
+		EXPECT_EQ(p.evaluate(t) * q.evaluate(t), res.evaluate(t));
+	}
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "carl/groebner/GBProcedure.h"
+
+#include "carl/groebner/Ideal.h"
+#include "carl/groebner/groebner.h"
+#include "carl/groebner/benchmarks/cyclic.h"
+#include "carl/groebner/benchmarks/katsura.h"
+
+#include "../Common.h"
+
+#include <vector>
+
+template<typename Coeff>
+using PolynomialWithReasonSet = carl::MultivariatePolynomial<Coeff, carl::GrLexOrdering, carl::StdMultivariatePolynomialPolicies<carl::BVReasons, carl::NoAllocator>>;
+
+/**
+ * Adds the input to the procedure and returns the resulting Groebner basis.
+ */
+template<typename Polynomial>
+std::vector<Polynomial> calculateBasis(carl::AbstractGBProcedure<Polynomial>& gb, const std::vector<Polynomial>& input)
+{
+	for(const auto& p: input) gb.addPolynomial(p);
+	gb.calculate();
+	return gb.getIdeal().getGenerators();
+}
+
+template<typename Polynomial>
+std::vector<Polynomial> normalized(const std::vector<Polynomial>& polynomials)
+{
+	std::vector<Polynomial> result;
+	for(const auto& p: polynomials) result.push_back(p.normalize());
+	return result;
+}
+
+/**
+ * Like calculateBasis(), but normalizes the generators, for procedures which do not normalize the basis themselves.
+ */
+template<typename Polynomial>
+std::vector<Polynomial> calculateNormalizedBasis(carl::AbstractGBProcedure<Polynomial>& gb, const std::vector<Polynomial>& input)
+{
+	return normalized(calculateBasis(gb, input));
+}
+
+/**
+ * The system x^3 - 2xy, x^2y - 2y^2 + x together with its reduced Groebner basis x^2, xy, y^2 - x/2 w.r.t. grlex.
+ * The real radical of the ideal is generated by x and y.
+ */
+struct T1System
+{
+	using Polynomial = carl::MultivariatePolynomial<Rational>;
+
+	carl::Variable x;
+	carl::Variable y;
+	Polynomial f1;
+	Polynomial f2;
+	Polynomial F1;
+	Polynomial F2;
+	Polynomial F3;
+
+	T1System():
+		x(carl::freshRealVariable("x")),
+		y(carl::freshRealVariable("y")),
+		f1({(Rational)1*x*x*x, (Rational)-2*x*y}),
+		f2({(Rational)1*x*x*y, (Rational)-2*y*y, (Rational)1*x}),
+		F1({(Rational)1*x*x}),
+		F2({(Rational)1*y*y, Rational(-1, 2)*x}),
+		F3({(Rational)1*x*y})
+	{}
+};
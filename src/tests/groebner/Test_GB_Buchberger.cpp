@@ -3,6 +3,8 @@
 
 #include "carl/groebner/Ideal.h"
 #include "carl/groebner/groebner.h"
+#include "carl/groebner/benchmarks/cyclic.h"
+#include "carl/groebner/benchmarks/katsura.h"
 #include "carl/util/platform.h"
 
 #include "../Common.h"
@@ -76,3 +78,241 @@ TEST(GB_Buchberger, T1_ReasonSets)
     EXPECT_EQ(x,gb2object.getIdeal().getGenerator(0));
     EXPECT_EQ(y,gb2object.getIdeal().getGenerator(1));
 }
+
+TEST(GB_Buchberger, PairSelection)
+{
+    using Poly = MultivariatePolynomial<Rational>;
+    Variable x = freshRealVariable("x");
+    Variable y = freshRealVariable("y");
+    Variable z = freshRealVariable("z");
+    // An inhomogeneous system.
+    std::vector<Poly> inhomogeneous = {
+        Poly({(Rational)1*x*x*y*z, (Rational)1*y, Term<Rational>(Rational(-1))}),
+        Poly({(Rational)1*x*y*y, (Rational)-1*z}),
+        Poly({(Rational)1*x*z*z, (Rational)1*x, (Rational)-1*y})
+    };
+    std::vector<std::vector<Poly>> inputs = {
+        benchmarks::cyclic<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<>>(3),
+        benchmarks::katsura<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<>>(3),
+        inhomogeneous
+    };
+    auto basis = [](AbstractGBProcedure<Poly>&& gb, const std::vector<Poly>& input)
+    {
+        for(const auto& p: input) gb.addPolynomial(p);
+        gb.calculate();
+        std::vector<Poly> res;
+        for(const auto& p: gb.getIdeal().getGenerators()) res.push_back(p.normalize());
+        return res;
+    };
+    for(const auto& input: inputs)
+    {
+        std::vector<Poly> expected = basis(GBProcedure<Poly, Buchberger, StdAdding>(), input);
+        EXPECT_EQ(expected, basis(GBProcedure<Poly, SugarBuchberger, StdAdding>(), input));
+        EXPECT_EQ(expected, basis(GBProcedure<Poly, DegreeAgeBuchberger, StdAdding>(), input));
+    }
+}
+
+TEST(GB_Buchberger, FractionFree)
+{
+    using Poly = MultivariatePolynomial<Rational>;
+    Variable x = freshRealVariable("x");
+    Variable y = freshRealVariable("y");
+    Variable z = freshRealVariable("z");
+    // A system with non-integral coefficients.
+    std::vector<Poly> fractional = {
+        Poly({Rational(3, 2)*x*x*y, Rational(-2, 3)*z, Term<Rational>(Rational(1, 5))}),
+        Poly({Rational(5)*x*y*y, Rational(-7, 4)*x*z}),
+        Poly({Rational(2, 7)*y*z*z, (Rational)3*x, Rational(-1, 3)*y})
+    };
+    std::vector<std::vector<Poly>> inputs = {
+        benchmarks::katsura<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<>>(3),
+        fractional
+    };
+    auto basis = [](AbstractGBProcedure<Poly>& gb, const std::vector<Poly>& input)
+    {
+        for(const auto& p: input) gb.addPolynomial(p);
+        gb.calculate();
+        std::vector<Poly> res;
+        for(const auto& p: gb.getIdeal().getGenerators()) res.push_back(p.normalize());
+        return res;
+    };
+    for(const auto& input: inputs)
+    {
+        GBProcedure<Poly, Buchberger, StdAdding> reference;
+        std::vector<Poly> expected = basis(reference, input);
+        GBProcedure<Poly, Buchberger, StdAdding> buchberger;
+        buchberger.setFractionFree();
+        EXPECT_EQ(expected, basis(buchberger, input));
+        GBProcedure<Poly, SugarBuchberger, StdAdding> sugar;
+        sugar.setFractionFree();
+        EXPECT_EQ(expected, basis(sugar, input));
+        GBProcedure<Poly, ParallelBuchberger, StdAdding> parallel;
+        parallel.setFractionFree();
+        EXPECT_EQ(expected, basis(parallel, input));
+    }
+}
+
+struct EliminateT
+{
+    static Variable& t() {
+        static Variable var = freshRealVariable("t");
+        return var;
+    }
+    static bool contains(Variable::Arg v) {
+        return v == t();
+    }
+};
+
+TEST(GB_Buchberger, Orderings)
+{
+    {
+        using Poly = MultivariatePolynomial<Rational, GrRevLexOrdering>;
+        std::vector<Poly> input = benchmarks::katsura<Rational, GrRevLexOrdering, StdMultivariatePolynomialPolicies<>>(3);
+        GBProcedure<Poly, Buchberger, StdAdding> buchberger;
+        GBProcedure<Poly, F4, StdAdding> f4;
+        for(const auto& p: input)
+        {
+            buchberger.addPolynomial(p);
+            f4.addPolynomial(p);
+        }
+        buchberger.calculate();
+        f4.calculate();
+        ASSERT_EQ(buchberger.getIdeal().nrGenerators(), f4.getIdeal().nrGenerators());
+        for(std::size_t i = 0; i < f4.getIdeal().nrGenerators(); ++i)
+        {
+            EXPECT_EQ(buchberger.getIdeal().getGenerator(i).normalize(), f4.getIdeal().getGenerator(i).normalize());
+        }
+    }
+    {
+        // Implicitization of the twisted cubic (t, t^2, t^3).
+        using Ordering = EliminationOrdering<EliminateT>;
+        using Poly = MultivariatePolynomial<Rational, Ordering>;
+        Variable t = EliminateT::t();
+        Variable x = freshRealVariable("x");
+        Variable y = freshRealVariable("y");
+        Variable z = freshRealVariable("z");
+        GBProcedure<Poly, SugarBuchberger, StdAdding> gb;
+        gb.addPolynomial(Poly({(Rational)1*x, (Rational)-1*t}));
+        gb.addPolynomial(Poly({(Rational)1*y, (Rational)-1*t*t}));
+        gb.addPolynomial(Poly({(Rational)1*z, (Rational)-1*t*t*t}));
+        gb.calculate();
+        std::vector<Poly> eliminated;
+        for(const auto& p: gb.getIdeal().getGenerators())
+        {
+            if(!p.has(t)) eliminated.push_back(p.normalize());
+        }
+        EXPECT_EQ(3, eliminated.size());
+        Ideal<Poly> ideal;
+        for(const auto& p: eliminated) ideal.addGenerator(p);
+        for(const Poly& p: { Poly({(Rational)1*x*x, (Rational)-1*y}), Poly({(Rational)1*x*y, (Rational)-1*z}), Poly({(Rational)1*y*y, (Rational)-1*x*z}) })
+        {
+            Reductor<Poly, Poly> reductor(ideal, p);
+            EXPECT_TRUE(reductor.fullReduce().isZero());
+        }
+    }
+}
+
+TEST(GB_Buchberger, Backtracking)
+{
+    using Poly = MultivariatePolynomial<Rational>;
+    Variable x = freshRealVariable("x");
+    Variable y = freshRealVariable("y");
+    Poly f1({(Rational)1*x*x*x, (Rational)-2*x*y});
+    Poly f2({(Rational)1*x*x*y, (Rational)-2*y*y, (Rational)1*x});
+    Poly f3({(Rational)1*x, (Rational)-1*y, Term<Rational>(Rational(-1))});
+    GBProcedure<Poly, Buchberger, StdAdding> gbobject;
+    gbobject.addPolynomial(f1);
+    gbobject.calculate();
+    std::vector<Poly> level0 = gbobject.getBasisPolynomials();
+
+    gbobject.push();
+    EXPECT_EQ(1, gbobject.nrLevels());
+    gbobject.addPolynomial(f2);
+    gbobject.calculate();
+    std::vector<Poly> level1 = gbobject.getBasisPolynomials();
+    EXPECT_EQ(3, level1.size());
+
+    gbobject.push();
+    gbobject.addPolynomial(f3);
+    gbobject.calculate();
+    EXPECT_TRUE(gbobject.basisIsConstant());
+    EXPECT_EQ(3, gbobject.nrOrigGenerators());
+
+    gbobject.pop();
+    EXPECT_EQ(level1, gbobject.getBasisPolynomials());
+    EXPECT_EQ(2, gbobject.nrOrigGenerators());
+    gbobject.pop();
+    EXPECT_EQ(0, gbobject.nrLevels());
+    EXPECT_EQ(level0, gbobject.getBasisPolynomials());
+    EXPECT_EQ(1, gbobject.nrOrigGenerators());
+
+    // Scheduled polynomials which are consumed within a level are scheduled again after pop.
+    gbobject.addPolynomial(f2);
+    gbobject.push();
+    gbobject.calculate();
+    EXPECT_TRUE(gbobject.inputEmpty());
+    gbobject.pop();
+    EXPECT_FALSE(gbobject.inputEmpty());
+    EXPECT_EQ(level0, gbobject.getBasisPolynomials());
+    gbobject.calculate();
+    EXPECT_EQ(level1, gbobject.getBasisPolynomials());
+
+    // A copy does not modify the bases of the levels of the original.
+    gbobject.push();
+    GBProcedure<Poly, Buchberger, StdAdding> copy(gbobject);
+    copy.pop();
+    copy.addPolynomial(f3);
+    copy.calculate();
+    EXPECT_TRUE(copy.basisIsConstant());
+    gbobject.pop();
+    EXPECT_EQ(level1, gbobject.getBasisPolynomials());
+
+    // Nested levels share the basis until it is modified.
+    gbobject.push();
+    gbobject.push();
+    GBProcedure<Poly, Buchberger, StdAdding> nested(gbobject);
+    gbobject.addPolynomial(f3);
+    gbobject.calculate();
+    EXPECT_TRUE(gbobject.basisIsConstant());
+    gbobject.pop();
+    EXPECT_EQ(level1, gbobject.getBasisPolynomials());
+    gbobject.addPolynomial(f3);
+    gbobject.calculate();
+    EXPECT_TRUE(gbobject.basisIsConstant());
+    gbobject.pop();
+    EXPECT_EQ(level1, gbobject.getBasisPolynomials());
+    nested.pop();
+    nested.pop();
+    EXPECT_EQ(level1, nested.getBasisPolynomials());
+
+    // A constant is found before the pair of f1 and f2 is processed, hence the pair is pending at push().
+    GBProcedure<Poly, Buchberger, StdAdding> pending;
+    pending.addPolynomial(f1);
+    pending.addPolynomial(f2);
+    pending.addPolynomial(Poly(Rational(3)));
+    pending.calculate();
+    EXPECT_TRUE(pending.basisIsConstant());
+    pending.push();
+    GBProcedure<Poly, Buchberger, StdAdding> pendingCopy(pending);
+    pending.pop();
+    EXPECT_TRUE(pending.basisIsConstant());
+    pendingCopy.pop();
+    EXPECT_TRUE(pendingCopy.basisIsConstant());
+}
+
+TEST(GB_Buchberger, CriticalPairsCopy)
+{
+    Variable x = freshRealVariable("x");
+    Variable y = freshRealVariable("y");
+    CritPairs pairs;
+    pairs.push({SPolPair(0, 1, createMonomial(x, 2)), SPolPair(0, 2, createMonomial(y, 3))});
+    // The copy owns its entries, so popping from one of them does not affect the other one.
+    CritPairs copy(pairs);
+    EXPECT_EQ(createMonomial(x, 2), copy.pop().mLcm);
+    EXPECT_EQ(createMonomial(y, 3), copy.pop().mLcm);
+    EXPECT_TRUE(copy.empty());
+    ASSERT_FALSE(pairs.empty());
+    EXPECT_EQ(createMonomial(x, 2), pairs.pop().mLcm);
+    EXPECT_EQ(createMonomial(y, 3), pairs.pop().mLcm);
+    EXPECT_TRUE(pairs.empty());
+}
@@ -0,0 +1,65 @@
+#include "gtest/gtest.h"
+#include "GBTestUtils.h"
+
+
+using namespace carl;
+
+TEST(GB_F4, T1)
+{
+	T1System t1;
+	GBProcedure<MultivariatePolynomial<Rational>, F4, StdAdding> gbobject;
+	gbobject.addPolynomial(t1.f1);
+	gbobject.addPolynomial(t1.f2);
+	gbobject.reduceInput();
+	gbobject.calculate();
+	EXPECT_EQ(3, gbobject.getIdeal().nrGenerators());
+	EXPECT_EQ(t1.F1,gbobject.getIdeal().getGenerator(0));
+	EXPECT_EQ(t1.F3,gbobject.getIdeal().getGenerator(1));
+	EXPECT_EQ(t1.F2,gbobject.getIdeal().getGenerator(2));
+	GBProcedure<MultivariatePolynomial<Rational>, F4, RealRadicalAwareAdding> gb2object;
+	gb2object.addPolynomial(t1.f1);
+	gb2object.addPolynomial(t1.f2);
+	gb2object.calculate();
+	EXPECT_EQ(t1.x,gb2object.getIdeal().getGenerator(0));
+	EXPECT_EQ(t1.y,gb2object.getIdeal().getGenerator(1));
+}
+
+TEST(GB_F4, Benchmarks)
+{
+	using Poly = MultivariatePolynomial<Rational>;
+	std::vector<std::vector<Poly>> inputs = {
+		benchmarks::cyclic<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<>>(3),
+		benchmarks::katsura<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<>>(3),
+		benchmarks::katsura<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<>>(4)
+	};
+	for(const auto& input: inputs)
+	{
+		GBProcedure<Poly, Buchberger, StdAdding> buchberger;
+		GBProcedure<Poly, F4, StdAdding> f4;
+		EXPECT_EQ(calculateBasis(buchberger, input), calculateBasis(f4, input));
+	}
+}
+
+TEST(GB_F4, ReasonSets)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+
+	PolynomialWithReasonSet<Rational> f1({(Rational)1*x*y, Term<Rational>(Rational(-1))});
+	f1.setReasons(BitVector(0));
+	PolynomialWithReasonSet<Rational> f2({(Rational)1*x, (Rational)1*z});
+	f2.setReasons(BitVector(1));
+	PolynomialWithReasonSet<Rational> f3({(Rational)1*z*y});
+	f3.setReasons(BitVector(2));
+	GBProcedure<PolynomialWithReasonSet<Rational>, F4, StdAdding> gbobject;
+	gbobject.addPolynomial(f1);
+	gbobject.addPolynomial(f2);
+	gbobject.addPolynomial(f3);
+	gbobject.calculate();
+	ASSERT_TRUE(gbobject.basisIsConstant());
+	BitVector reasons = gbobject.getIdeal().getGenerator(0).getReasons();
+	EXPECT_TRUE(reasons.getBit(0));
+	EXPECT_TRUE(reasons.getBit(1));
+	EXPECT_TRUE(reasons.getBit(2));
+}
@@ -0,0 +1,51 @@
+#include "gtest/gtest.h"
+#include "GBTestUtils.h"
+
+
+using namespace carl;
+
+TEST(GB_MultiModular, T1)
+{
+	T1System t1;
+	GBProcedure<MultivariatePolynomial<Rational>, MultiModular, StdAdding> gbobject;
+	gbobject.addPolynomial(t1.f1);
+	gbobject.addPolynomial(t1.f2);
+	gbobject.calculate();
+	EXPECT_EQ(3, gbobject.getIdeal().nrGenerators());
+	EXPECT_EQ(t1.F1,gbobject.getIdeal().getGenerator(0));
+	EXPECT_EQ(t1.F3,gbobject.getIdeal().getGenerator(1));
+	EXPECT_EQ(t1.F2,gbobject.getIdeal().getGenerator(2));
+}
+
+TEST(GB_MultiModular, Benchmarks)
+{
+	using Poly = MultivariatePolynomial<Rational>;
+	std::vector<std::vector<Poly>> inputs = {
+		benchmarks::cyclic<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<>>(3),
+		benchmarks::katsura<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<>>(3),
+		benchmarks::katsura<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<>>(4)
+	};
+	for(const auto& input: inputs)
+	{
+		GBProcedure<Poly, Buchberger, StdAdding> buchberger;
+		GBProcedure<Poly, MultiModular, StdAdding> modular;
+		GBProcedure<Poly, ProbabilisticMultiModular, StdAdding> probabilistic;
+		std::vector<Poly> expected = calculateBasis(buchberger, input);
+		EXPECT_EQ(expected, calculateBasis(modular, input));
+		EXPECT_EQ(expected, calculateBasis(probabilistic, input));
+	}
+}
+
+TEST(GB_MultiModular, Inconsistent)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+
+	MultivariatePolynomial<Rational> f1({(Rational)1*x*y, Term<Rational>(Rational(-1))});
+	MultivariatePolynomial<Rational> f2({(Rational)3*x});
+	GBProcedure<MultivariatePolynomial<Rational>, MultiModular, StdAdding> gbobject;
+	gbobject.addPolynomial(f1);
+	gbobject.addPolynomial(f2);
+	gbobject.calculate();
+	EXPECT_TRUE(gbobject.basisIsConstant());
+}
@@ -0,0 +1,77 @@
+#include "gtest/gtest.h"
+#include "GBTestUtils.h"
+
+
+using namespace carl;
+
+struct SmallBatchSettings : DefaultParallelBuchbergerSettings
+{
+	static const std::size_t maxBatchSize = 2;
+	static const unsigned maxThreads = 2;
+};
+
+template<typename Polynomial, template<typename> class AddingPolicy>
+using SmallBatchParallelBuchberger = ParallelBuchbergerProcedure<Polynomial, AddingPolicy, SmallBatchSettings>;
+
+TEST(GB_ParallelBuchberger, T1)
+{
+	T1System t1;
+	GBProcedure<MultivariatePolynomial<Rational>, ParallelBuchberger, StdAdding> gbobject;
+	gbobject.addPolynomial(t1.f1);
+	gbobject.addPolynomial(t1.f2);
+	gbobject.reduceInput();
+	gbobject.calculate();
+	EXPECT_EQ(3, gbobject.getIdeal().nrGenerators());
+	EXPECT_EQ(t1.F1,gbobject.getIdeal().getGenerator(0));
+	EXPECT_EQ(t1.F3,gbobject.getIdeal().getGenerator(1));
+	EXPECT_EQ(t1.F2,gbobject.getIdeal().getGenerator(2));
+	GBProcedure<MultivariatePolynomial<Rational>, ParallelBuchberger, RealRadicalAwareAdding> gb2object;
+	gb2object.addPolynomial(t1.f1);
+	gb2object.addPolynomial(t1.f2);
+	gb2object.calculate();
+	EXPECT_EQ(t1.x,gb2object.getIdeal().getGenerator(0));
+	EXPECT_EQ(t1.y,gb2object.getIdeal().getGenerator(1));
+}
+
+TEST(GB_ParallelBuchberger, Benchmarks)
+{
+	using Poly = MultivariatePolynomial<Rational>;
+	std::vector<std::vector<Poly>> inputs = {
+		benchmarks::cyclic<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<>>(3),
+		benchmarks::katsura<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<>>(3),
+		benchmarks::katsura<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<>>(4)
+	};
+	for(const auto& input: inputs)
+	{
+		GBProcedure<Poly, Buchberger, StdAdding> buchberger;
+		GBProcedure<Poly, ParallelBuchberger, StdAdding> parallel;
+		GBProcedure<Poly, SmallBatchParallelBuchberger, StdAdding> smallBatches;
+		std::vector<Poly> expected = calculateBasis(buchberger, input);
+		EXPECT_EQ(expected, calculateBasis(parallel, input));
+		EXPECT_EQ(expected, calculateBasis(smallBatches, input));
+	}
+}
+
+TEST(GB_ParallelBuchberger, ReasonSets)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+
+	PolynomialWithReasonSet<Rational> f1({(Rational)1*x*y, Term<Rational>(Rational(-1))});
+	f1.setReasons(BitVector(0));
+	PolynomialWithReasonSet<Rational> f2({(Rational)1*x, (Rational)1*z});
+	f2.setReasons(BitVector(1));
+	PolynomialWithReasonSet<Rational> f3({(Rational)1*z*y});
+	f3.setReasons(BitVector(2));
+	GBProcedure<PolynomialWithReasonSet<Rational>, ParallelBuchberger, StdAdding> gbobject;
+	gbobject.addPolynomial(f1);
+	gbobject.addPolynomial(f2);
+	gbobject.addPolynomial(f3);
+	gbobject.calculate();
+	ASSERT_TRUE(gbobject.basisIsConstant());
+	BitVector reasons = gbobject.getIdeal().getGenerator(0).getReasons();
+	EXPECT_TRUE(reasons.getBit(0));
+	EXPECT_TRUE(reasons.getBit(1));
+	EXPECT_TRUE(reasons.getBit(2));
+}
@@ -0,0 +1,100 @@
+#include "gtest/gtest.h"
+#include "GBTestUtils.h"
+
+
+using namespace carl;
+
+TEST(GB_SignatureBased, T1)
+{
+	T1System t1;
+	GBProcedure<MultivariatePolynomial<Rational>, SignatureBased, StdAdding> gbobject;
+	gbobject.addPolynomial(t1.f1);
+	gbobject.addPolynomial(t1.f2);
+	gbobject.reduceInput();
+	gbobject.calculate();
+	EXPECT_EQ(3, gbobject.getIdeal().nrGenerators());
+	EXPECT_EQ(t1.F1,gbobject.getIdeal().getGenerator(0));
+	EXPECT_EQ(t1.F3,gbobject.getIdeal().getGenerator(1));
+	EXPECT_EQ(t1.F2,gbobject.getIdeal().getGenerator(2));
+	GBProcedure<MultivariatePolynomial<Rational>, SignatureBased, RealRadicalAwareAdding> gb2object;
+	gb2object.addPolynomial(t1.f1);
+	gb2object.addPolynomial(t1.f2);
+	gb2object.calculate();
+	EXPECT_EQ(t1.x,gb2object.getIdeal().getGenerator(0));
+	EXPECT_EQ(t1.y,gb2object.getIdeal().getGenerator(1));
+}
+
+TEST(GB_SignatureBased, Benchmarks)
+{
+	using Poly = MultivariatePolynomial<Rational>;
+	std::vector<std::vector<Poly>> inputs = {
+		benchmarks::cyclic<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<>>(3),
+		benchmarks::katsura<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<>>(3),
+		benchmarks::katsura<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<>>(4),
+		benchmarks::katsura<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<>>(5)
+	};
+	for(const auto& input: inputs)
+	{
+		GBProcedure<Poly, Buchberger, StdAdding> buchberger;
+		GBProcedure<Poly, SignatureBased, StdAdding> signature;
+		EXPECT_EQ(calculateNormalizedBasis(buchberger, input), calculateNormalizedBasis(signature, input));
+	}
+}
+
+TEST(GB_SignatureBased, NoZeroReductions)
+{
+	// The katsura systems are regular sequences, hence every reduction to zero is detected by the criteria.
+	using Poly = MultivariatePolynomial<Rational>;
+	for(unsigned n = 3; n <= 5; ++n)
+	{
+		std::vector<Poly> input = benchmarks::katsura<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<>>(n);
+		SignatureBased<Poly, StdAdding> signature;
+		signature.setIdeal(std::make_shared<Ideal<Poly>>());
+		signature.calculate(std::list<Poly>(input.begin(), input.end()));
+		EXPECT_LT(0, signature.nrReductions());
+		EXPECT_EQ(0, signature.nrZeroReductions());
+	}
+}
+
+TEST(GB_SignatureBased, Incremental)
+{
+	using Poly = MultivariatePolynomial<Rational>;
+	std::vector<Poly> input = benchmarks::katsura<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<>>(3);
+	GBProcedure<Poly, Buchberger, StdAdding> buchberger;
+	GBProcedure<Poly, SignatureBased, StdAdding> signature;
+	for(const auto& p: input)
+	{
+		buchberger.addPolynomial(p);
+		buchberger.calculate();
+		signature.addPolynomial(p);
+		signature.calculate();
+		EXPECT_EQ(normalized(buchberger.getIdeal().getGenerators()), normalized(signature.getIdeal().getGenerators()));
+	}
+}
+
+TEST(GB_SignatureBased, ReasonSets)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+
+	PolynomialWithReasonSet<Rational> f1({(Rational)1*x*y, Term<Rational>(Rational(-1))});
+	f1.setReasons(BitVector(0));
+	PolynomialWithReasonSet<Rational> f2({(Rational)1*x, (Rational)1*z});
+	f2.setReasons(BitVector(1));
+	PolynomialWithReasonSet<Rational> f3({(Rational)1*z*y});
+	f3.setReasons(BitVector(2));
+	PolynomialWithReasonSet<Rational> f4({(Rational)1*z, (Rational)1*y});
+	f4.setReasons(BitVector(3));
+	GBProcedure<PolynomialWithReasonSet<Rational>, SignatureBased, StdAdding> gbobject;
+	gbobject.addPolynomial(f1);
+	gbobject.addPolynomial(f2);
+	gbobject.addPolynomial(f3);
+	gbobject.addPolynomial(f4);
+	gbobject.calculate();
+	ASSERT_TRUE(gbobject.basisIsConstant());
+	BitVector reasons = gbobject.getIdeal().getGenerator(0).getReasons();
+	EXPECT_TRUE(reasons.getBit(0));
+	EXPECT_TRUE(reasons.getBit(1));
+	EXPECT_TRUE(reasons.getBit(2));
+}
@@ -25,3 +25,45 @@ TEST(Ideal, Construction)
     ideal.addGenerator(p2);
     ideal.print();
 }
+
+TEST(Ideal, DivisorLookup)
+{
+    using Poly = MultivariatePolynomial<Rational>;
+    std::vector<Variable> vars;
+    for(std::size_t i = 0; i < 4; ++i) vars.push_back(freshRealVariable());
+    Ideal<Poly, IdealDatastructureVector> vectorIdeal;
+    Ideal<Poly, IdealDatastructureKDTree> treeIdeal;
+    std::vector<Monomial::Arg> monomials;
+    for(exponent a = 0; a < 4; ++a)
+    for(exponent b = 0; b < 4; ++b)
+    for(exponent c = 0; c < 3; ++c)
+    for(exponent d = 0; d < 3; ++d)
+    {
+        Monomial::Arg m;
+        for(exponent e = 0; e < a; ++e) m = m * vars[0];
+        for(exponent e = 0; e < b; ++e) m = m * vars[1];
+        for(exponent e = 0; e < c; ++e) m = m * vars[2];
+        for(exponent e = 0; e < d; ++e) m = m * vars[3];
+        monomials.push_back(m);
+        // Generators whose leading monomials are not pairwise divisible.
+        if(a + b + c + d == 4)
+        {
+            Poly p({Term<Rational>(Rational(1), m), Term<Rational>(Rational(3))});
+            vectorIdeal.addGenerator(p);
+            treeIdeal.addGenerator(p);
+        }
+    }
+    ASSERT_LT(8, treeIdeal.nrGenerators());
+    vectorIdeal.eliminateGenerator(3);
+    treeIdeal.eliminateGenerator(3);
+    for(const auto& m: monomials)
+    {
+        Term<Rational> t(Rational(2), m);
+        DivisionLookupResult<Poly> expected = vectorIdeal.getDivisor(t);
+        DivisionLookupResult<Poly> found = treeIdeal.getDivisor(t);
+        ASSERT_EQ(expected.mDivisor == nullptr, found.mDivisor == nullptr);
+        if(expected.mDivisor == nullptr) continue;
+        EXPECT_EQ(*expected.mDivisor, *found.mDivisor);
+        EXPECT_EQ(expected.mFactor, found.mFactor);
+    }
+}
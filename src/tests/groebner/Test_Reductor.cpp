@@ -50,3 +50,61 @@ TEST(Reductor, Reduction)
     fres = reductor4.fullReduce();
     EXPECT_EQ((Rational)-1 * z, fres);
 }
+
+TEST(Reductor, Sugar)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+	Ideal<MultivariatePolynomial<Rational>> ideal;
+	MultivariatePolynomial<Rational> p1;
+	p1 += x*x;
+	p1 += z;
+	MultivariatePolynomial<Rational> p2;
+	p2 += y*y;
+	ideal.addGenerator(p1);
+	ideal.addGenerator(p2);
+	// The first generator stems from a polynomial of higher degree, the second one has no entry.
+	std::vector<exponent> sugar = { 5 };
+
+	MultivariatePolynomial<Rational> f;
+	f += x*x*y;
+	Reductor<MultivariatePolynomial<Rational>, MultivariatePolynomial<Rational>> reductor(ideal, f);
+	reductor.trackSugar(3, &sugar);
+	EXPECT_EQ((Rational)-1 * y * z, reductor.fullReduce());
+	EXPECT_EQ(6, reductor.sugar());
+
+	MultivariatePolynomial<Rational> f2;
+	f2 += x*y*y;
+	Reductor<MultivariatePolynomial<Rational>, MultivariatePolynomial<Rational>> reductor2(ideal, f2);
+	reductor2.trackSugar(4, &sugar);
+	EXPECT_EQ(MultivariatePolynomial<Rational>(), reductor2.fullReduce());
+	EXPECT_EQ(4, reductor2.sugar());
+}
+
+TEST(Reductor, FractionFree)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Ideal<MultivariatePolynomial<Rational>> ideal;
+	ideal.addGenerator(MultivariatePolynomial<Rational>({(Rational)2*x, Term<Rational>(Rational(1))}));
+	ideal.addGenerator(MultivariatePolynomial<Rational>({(Rational)3*y*y, (Rational)-1*x}));
+
+	std::vector<MultivariatePolynomial<Rational>> inputs = {
+		MultivariatePolynomial<Rational>({(Rational)1*x*x}),
+		MultivariatePolynomial<Rational>({(Rational)5*x*y*y*y, (Rational)1*y}),
+		MultivariatePolynomial<Rational>({(Rational)1*y*y, (Rational)1*x*y}),
+		MultivariatePolynomial<Rational>({(Rational)1*y})
+	};
+	for(const auto& f: inputs)
+	{
+		Reductor<MultivariatePolynomial<Rational>, MultivariatePolynomial<Rational>> reductor(ideal, f);
+		MultivariatePolynomial<Rational> expected = reductor.fullReduce();
+		Reductor<MultivariatePolynomial<Rational>, MultivariatePolynomial<Rational>> fractionFree(ideal, f);
+		fractionFree.setFractionFree();
+		MultivariatePolynomial<Rational> res = fractionFree.fullReduce();
+		EXPECT_EQ(expected.normalize(), res.normalize());
+		// The content is removed.
+		EXPECT_EQ(res, res.coprimeCoefficients());
+	}
+}
@@ -68,3 +68,28 @@ TEST(GaloisField, integers)
 
 
 
+
+TEST(GaloisField, compoundAssignment)
+{
+    GaloisFieldManager<mpz_class>& gfm = GaloisFieldManager<mpz_class>::getInstance();
+    const GaloisField<mpz_class>* gf7 = gfm.getField(7,1);
+    GFNumber<mpz_class> a2(2,gf7);
+    GFNumber<mpz_class> a3(3,gf7);
+
+    EXPECT_EQ(mpz_class(-1), GFNumber<mpz_class>(-15,gf7).representingInteger());
+
+    GFNumber<mpz_class> b = a3;
+    b *= a3;
+    EXPECT_EQ(mpz_class(2), b.representingInteger());
+    b /= a2;
+    EXPECT_EQ(mpz_class(1), b.representingInteger());
+    b -= a3;
+    EXPECT_EQ(mpz_class(-2), b.representingInteger());
+    b += a2;
+    EXPECT_TRUE(b.isZero());
+
+    GFNumber<mpz_class> c(1);
+    c *= a3;
+    EXPECT_EQ(gf7, c.gf());
+    EXPECT_EQ(a3, c / GFNumber<mpz_class>(1));
+}
@@ -2,6 +2,8 @@
 
 #include "carl/util/carlTree.h"
 
+#include <vector>
+
 using namespace carl;
 
 TEST(Allocator, Basic)
@@ -41,3 +43,33 @@ TEST(Allocator, Basic)
 	for (auto i = t.begin_path(i1); i != t.end_path(); ++i) std::cout << *i << ", ";
 	std::cout << std::endl;
 }
+
+TEST(Allocator, Recycling)
+{
+	carl::tree<int> t;
+	auto i1 = t.append(1);
+	auto i2 = t.append(2);
+	for (int i = 0; i < 3; i++) {
+		auto c = t.append(i1, 10 + i);
+		t.append(c, 100 + i);
+	}
+	EXPECT_EQ(9, t.allocated());
+	// erasing i1 releases its whole subtree at once
+	t.erase(i1);
+	EXPECT_TRUE(t.isConsistent());
+	// the nodes of the erased subtree are reused
+	for (int i = 0; i < 7; i++) t.append(i2, 20 + i);
+	EXPECT_EQ(9, t.allocated());
+	std::vector<int> before;
+	for (auto i = t.begin_preorder(); i != t.end_preorder(); ++i) before.push_back(*i);
+
+	t.eraseChildren(t.begin_children(t.begin()));
+	t.append(t.begin(), 3);
+	t.compact();
+	EXPECT_EQ(3, t.allocated());
+	std::vector<int> after;
+	for (auto i = t.begin_preorder(); i != t.end_preorder(); ++i) after.push_back(*i);
+	std::vector<int> expected({ before[0], 2, 3 });
+	EXPECT_EQ(expected, after);
+	EXPECT_EQ(1, t.max_depth());
+}
@@ -0,0 +1,36 @@
+#include "../Common.h"
+
+#include <carl/util/ThreadPool.h>
+
+#include <atomic>
+#include <vector>
+
+TEST(ThreadPool, Submit)
+{
+	carl::ThreadPool pool(3);
+	EXPECT_EQ(3, pool.size());
+	std::vector<std::future<int>> results;
+	for (int i = 0; i < 10; i++) {
+		results.push_back(pool.submit([i](){ return i * i; }));
+	}
+	for (int i = 0; i < 10; i++) {
+		EXPECT_EQ(i * i, results[std::size_t(i)].get());
+	}
+}
+
+TEST(ThreadPool, ParallelFor)
+{
+	for (std::size_t threads: {0, 1, 4}) {
+		carl::ThreadPool pool(threads);
+		std::vector<int> values(100, 0);
+		std::atomic<std::size_t> calls(0);
+		pool.parallelFor(values.size(), [&](std::size_t i){
+			values[i] = int(i);
+			calls++;
+		});
+		EXPECT_EQ(values.size(), calls.load());
+		for (std::size_t i = 0; i < values.size(); i++) {
+			EXPECT_EQ(int(i), values[i]);
+		}
+	}
+}